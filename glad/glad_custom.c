@@ -20,6 +20,11 @@ static void load_Desktop_GL(GLADloadproc load) {
         glad_glDrawElementsInstancedBaseVertexBaseInstanceEXT = (PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCEEXTPROC)load("glDrawElementsInstancedBaseVertexBaseInstance");
     }
 
+    if (GLAD_IS_GL_VERSION_AT_LEAST(3, 3)) {
+        GLAD_GL_EXT_disjoint_timer_query = 1;
+        glad_glGetQueryObjectui64vEXT = (PFNGLGETQUERYOBJECTUI64VEXTPROC)load("glGetQueryObjectui64v");
+    }
+
     if (GLAD_IS_GL_VERSION_AT_LEAST(4, 6))
     {
         GLAD_GL_ANGLE_base_vertex_base_instance_shader_builtin = 1;
@@ -41,6 +46,7 @@ PFNGLPROVOKINGVERTEXANGLEPROC glad_glProvokingVertexANGLE = NULL;
 PFNGLGETTEXTUREHANDLEARB glad_glGetTextureHandleARB = NULL;
 PFNGLMAKETEXTUREHANDLERESIDENTARB glad_glMakeTextureHandleResidentARB = NULL;
 PFNGLMAKETEXTUREHANDLENONRESIDENTARB glad_glMakeTextureHandleNonResidentARB = NULL;
+PFNGLGETQUERYOBJECTUI64VEXTPROC glad_glGetQueryObjectui64vEXT = NULL;
 /* #ifdef RIVE_DESKTOP_GL */
 /* #endif */
 int GLAD_GL_ANGLE_base_vertex_base_instance_shader_builtin = 0;
@@ -49,6 +55,7 @@ int GLAD_GL_ANGLE_shader_pixel_local_storage_coherent = 0;
 int GLAD_GL_ANGLE_polygon_mode = 0;
 int GLAD_GL_ANGLE_provoking_vertex = 0;
 int GLAD_GL_ARB_bindless_texture = 0;
+int GLAD_GL_EXT_disjoint_timer_query = 0;
 static void load_GL_ANGLE_shader_pixel_local_storage(GLADloadproc load) {
     if(!GLAD_GL_ANGLE_shader_pixel_local_storage) return;
     glad_glFramebufferMemorylessPixelLocalStorageANGLE = (PFNGLFRAMEBUFFERMEMORYLESSPIXELLOCALSTORAGEANGLEPROC)load("glFramebufferMemorylessPixelLocalStorageANGLE");
@@ -76,6 +83,10 @@ static void load_GL_ARB_bindless_texture(GLADloadproc load) {
     glad_glMakeTextureHandleResidentARB = (PFNGLMAKETEXTUREHANDLERESIDENTARB)load("glMakeTextureHandleResidentARB");
     glad_glMakeTextureHandleNonResidentARB = (PFNGLMAKETEXTUREHANDLENONRESIDENTARB)load("glMakeTextureHandleNonResidentARB");
 }
+static void load_GL_EXT_disjoint_timer_query(GLADloadproc load) {
+    if(!GLAD_GL_EXT_disjoint_timer_query) return;
+    glad_glGetQueryObjectui64vEXT = (PFNGLGETQUERYOBJECTUI64VEXTPROC)load("glGetQueryObjectui64vEXT");
+}
 int gladLoadCustomLoader(GLADloadproc load) {
     int ret = gladLoadGLES2Loader(load);
 
@@ -127,10 +138,15 @@ int gladLoadCustomLoader(GLADloadproc load) {
         {
             GLAD_GL_ARB_bindless_texture = 1;
         }
+        else if (strcmp(ext, "GL_EXT_disjoint_timer_query") == 0)
+        {
+            GLAD_GL_EXT_disjoint_timer_query = 1;
+        }
     }
     load_GL_ANGLE_shader_pixel_local_storage(load);
     load_GL_ANGLE_polygon_mode(load);
     load_GL_ANGLE_provoking_vertex(load);
+    load_GL_EXT_disjoint_timer_query(load);
     load_Desktop_GL(load);
     load_GL_ARB_bindless_texture(load);
     return ret;
@@ -109,6 +109,16 @@ GLAPI PFNGLMAKETEXTUREHANDLENONRESIDENTARB glad_glMakeTextureHandleNonResidentAR
 #define glMakeTextureHandleNonResidentARB glad_glMakeTextureHandleNonResidentARB
 #endif  /* GL_ARB_bindless_texture */
 
+#ifndef GL_EXT_disjoint_timer_query
+#define GL_EXT_disjoint_timer_query 1
+#define GL_TIME_ELAPSED_EXT 0x88BF
+#define GL_GPU_DISJOINT_EXT 0x8FBB
+GLAPI int GLAD_GL_EXT_disjoint_timer_query;
+typedef void (APIENTRYP PFNGLGETQUERYOBJECTUI64VEXTPROC) (GLuint id, GLenum pname, GLuint64* params);
+GLAPI PFNGLGETQUERYOBJECTUI64VEXTPROC glad_glGetQueryObjectui64vEXT;
+#define glGetQueryObjectui64vEXT glad_glGetQueryObjectui64vEXT
+#endif  /* GL_EXT_disjoint_timer_query */
+
 #ifdef __cplusplus
 }
 #endif
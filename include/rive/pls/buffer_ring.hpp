@@ -39,10 +39,16 @@ public:
 
     // Submits the currently-mapped buffer for GPU rendering, in whatever way that is meaningful for
     // the PLSRenderContext implementation.
-    void unmapAndSubmitBuffer()
+    void unmapAndSubmitBuffer() { unmapAndSubmitBuffer(m_mapSizeInBytes); }
+
+    // Submits the currently-mapped buffer for GPU rendering, but only the first 'updateSizeInBytes'
+    // bytes need to be uploaded. This is for buffers whose mapping size is a conservative upper
+    // bound, and whose exact contents are not known until after they have been written.
+    void unmapAndSubmitBuffer(size_t updateSizeInBytes)
     {
         assert(isMapped());
-        onUnmapAndSubmitBuffer(m_submittedBufferIdx, m_mapSizeInBytes);
+        assert(updateSizeInBytes <= m_mapSizeInBytes);
+        onUnmapAndSubmitBuffer(m_submittedBufferIdx, updateSizeInBytes);
         m_mapSizeInBytes = 0;
     }
 
@@ -54,7 +60,9 @@ protected:
     }
 
     virtual void* onMapBuffer(int bufferIdx, size_t mapSizeInBytes) = 0;
-    virtual void onUnmapAndSubmitBuffer(int bufferIdx, size_t mapSizeInBytes) = 0;
+    // 'updateSizeInBytes' may be smaller than the mapping size, in which case only that many bytes
+    // need to be uploaded to the GPU.
+    virtual void onUnmapAndSubmitBuffer(int bufferIdx, size_t updateSizeInBytes) = 0;
 
     uint8_t* shadowBuffer() const
     {
@@ -84,6 +92,6 @@ public:
 
 protected:
     void* onMapBuffer(int bufferIdx, size_t mapSizeInBytes) override { return shadowBuffer(); }
-    void onUnmapAndSubmitBuffer(int bufferIdx, size_t mapSizeInBytes) override {}
+    void onUnmapAndSubmitBuffer(int bufferIdx, size_t updateSizeInBytes) override {}
 };
 } // namespace rive::pls
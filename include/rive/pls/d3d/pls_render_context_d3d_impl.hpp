@@ -114,6 +114,11 @@ private:
                                      uint32_t height,
                                      uint32_t mipLevelCount,
                                      const uint8_t imageDataRGBA[]) override;
+    rcp<PLSTexture> makeCompressedImageTexture(uint32_t width,
+                                               uint32_t height,
+                                               CompressedTextureFormat,
+                                               const Span<const uint8_t> mipLevels[],
+                                               uint32_t mipLevelCount) override;
 
     std::unique_ptr<BufferRing> makeUniformBufferRing(size_t capacityInBytes) override;
     std::unique_ptr<BufferRing> makeStorageBufferRing(size_t capacityInBytes,
@@ -95,6 +95,14 @@ extern void glProvokingVertexANGLE(GLenum provokeMode);
 #define GL_CLIP_DISTANCE2_EXT 0x3002
 #define GL_CLIP_DISTANCE3_EXT 0x3003
 #endif
+
+#ifndef GL_EXT_disjoint_timer_query
+#define GL_EXT_disjoint_timer_query 1
+#define GL_TIME_ELAPSED_EXT 0x88BF
+#define GL_GPU_DISJOINT_EXT 0x8FBB
+// Timer queries aren't enabled on WebGL. Placate the compiler in the GL timing code.
+#define glGetQueryObjectui64vEXT(ID, PNAME, PARAMS) (*(PARAMS) = 0)
+#endif
 #endif // RIVE_WEBGL
 
 #if defined(RIVE_GLES) || defined(RIVE_WEBGL)
@@ -104,6 +112,23 @@ extern void glProvokingVertexANGLE(GLenum provokeMode);
 #define GL_MAX_VERTEX_SHADER_STORAGE_BLOCKS 0x90D6
 #endif
 
+// Block-compressed texture formats. Not all headers define these, and some of them are exposed as
+// extensions.
+#ifndef GL_COMPRESSED_RGBA_S3TC_DXT1_EXT
+#define GL_COMPRESSED_RGBA_S3TC_DXT1_EXT 0x83F1
+#define GL_COMPRESSED_RGBA_S3TC_DXT5_EXT 0x83F3
+#endif
+#ifndef GL_COMPRESSED_RGBA_BPTC_UNORM_EXT
+#define GL_COMPRESSED_RGBA_BPTC_UNORM_EXT 0x8E8C
+#endif
+#ifndef GL_COMPRESSED_RGB8_ETC2
+#define GL_COMPRESSED_RGB8_ETC2 0x9274
+#define GL_COMPRESSED_RGBA8_ETC2_EAC 0x9278
+#endif
+#ifndef GL_COMPRESSED_RGBA_ASTC_4x4_KHR
+#define GL_COMPRESSED_RGBA_ASTC_4x4_KHR 0x93B0
+#endif
+
 struct GLCapabilities
 {
     GLCapabilities() { memset(this, 0, sizeof(*this)); }
@@ -129,11 +154,16 @@ struct GLCapabilities
     bool ARB_shader_storage_buffer_object : 1;
     bool KHR_blend_equation_advanced : 1;
     bool KHR_blend_equation_advanced_coherent : 1;
+    bool KHR_texture_compression_astc_ldr : 1;
     bool EXT_base_instance : 1;
     bool EXT_clip_cull_distance : 1;
+    bool EXT_disjoint_timer_query : 1;
     bool INTEL_fragment_shader_ordering : 1;
     bool EXT_shader_framebuffer_fetch : 1;
     bool EXT_shader_pixel_local_storage : 1;
+    bool EXT_texture_compression_bptc : 1;
+    bool EXT_texture_compression_s3tc : 1;
+    bool OES_compressed_ETC2_RGBA8_texture : 1;
     bool QCOM_shader_framebuffer_fetch_noncoherent : 1;
 };
 
@@ -144,5 +174,6 @@ extern PFNGLDRAWELEMENTSINSTANCEDBASEINSTANCEEXTPROC glDrawElementsInstancedBase
 extern PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCEEXTPROC
     glDrawElementsInstancedBaseVertexBaseInstanceEXT;
 extern PFNGLFRAMEBUFFERFETCHBARRIERQCOMPROC glFramebufferFetchBarrierQCOM;
+extern PFNGLGETQUERYOBJECTUI64VEXTPROC glGetQueryObjectui64vEXT;
 void LoadGLESExtensions(const GLCapabilities&);
 #endif
@@ -38,6 +38,11 @@ public:
                                      uint32_t height,
                                      uint32_t mipLevelCount,
                                      const uint8_t imageDataRGBA[]) override;
+    rcp<PLSTexture> makeCompressedImageTexture(uint32_t width,
+                                               uint32_t height,
+                                               CompressedTextureFormat,
+                                               const Span<const uint8_t> mipLevels[],
+                                               uint32_t mipLevelCount) override;
 
     // Takes ownership of textureID and responsibility for deleting it.
     rcp<PLSTexture> adoptImageTexture(uint32_t width, uint32_t height, GLuint textureID);
@@ -178,6 +183,15 @@ private:
 
     void flush(const FlushDescriptor&) override;
 
+#ifdef RIVE_PLS_STATS
+    const PLSRenderContext::GPUFrameStats* lastGPUFrameStats() const override;
+
+    // Times the stages of each flush with GL_TIME_ELAPSED queries, and reads them back once they
+    // resolve. Null if timer queries aren't supported.
+    class GPUTimer;
+    std::unique_ptr<GPUTimer> m_gpuTimer;
+#endif
+
     GLCapabilities m_capabilities;
 
     std::unique_ptr<PLSImpl> m_plsImpl;
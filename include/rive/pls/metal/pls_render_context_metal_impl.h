@@ -111,6 +111,11 @@ public:
                                      uint32_t height,
                                      uint32_t mipLevelCount,
                                      const uint8_t imageDataRGBA[]) override;
+    rcp<PLSTexture> makeCompressedImageTexture(uint32_t width,
+                                               uint32_t height,
+                                               CompressedTextureFormat,
+                                               const Span<const uint8_t> mipLevels[],
+                                               uint32_t mipLevelCount) override;
 
     // Atomic mode requires a barrier between overlapping draws. We have to implement this barrier
     // in various different ways, depending on which hardware we're on.
@@ -89,9 +89,53 @@ static_assert(1 << kTessTextureWidthLog2 == kTessTextureWidth);
 constexpr static size_t kGradTextureWidth = 512;
 constexpr static size_t kGradTextureWidthInSimpleRamps = kGradTextureWidth / 2;
 
+// Block-compressed image formats that can be uploaded and sampled without decompressing. All of
+// these formats use 4x4 blocks.
+enum class CompressedTextureFormat : uint8_t
+{
+    bc1RGBA,
+    bc3RGBA,
+    bc7RGBA,
+    etc2RGB8,
+    etc2RGBA8,
+    astc4x4RGBA,
+};
+constexpr static uint32_t kCompressedTextureBlockDim = 4;
+
+constexpr static uint32_t CompressedTextureBlockSizeInBytes(CompressedTextureFormat format)
+{
+    switch (format)
+    {
+        case CompressedTextureFormat::bc1RGBA:
+        case CompressedTextureFormat::etc2RGB8:
+            return 8;
+        case CompressedTextureFormat::bc3RGBA:
+        case CompressedTextureFormat::bc7RGBA:
+        case CompressedTextureFormat::etc2RGBA8:
+        case CompressedTextureFormat::astc4x4RGBA:
+            return 16;
+    }
+    RIVE_UNREACHABLE();
+}
+
+// Size of one mip level of a compressed texture, in bytes.
+constexpr static size_t CompressedTextureLevelSizeInBytes(CompressedTextureFormat format,
+                                                          uint32_t width,
+                                                          uint32_t height)
+{
+    size_t blocksWide = (width + kCompressedTextureBlockDim - 1) / kCompressedTextureBlockDim;
+    size_t blocksHigh = (height + kCompressedTextureBlockDim - 1) / kCompressedTextureBlockDim;
+    return blocksWide * blocksHigh * CompressedTextureBlockSizeInBytes(format);
+}
+
 // Backend-specific capabilities/workarounds and fine tuning.
 struct PlatformFeatures
 {
+    bool supportsCompressedTextureFormat(CompressedTextureFormat format) const
+    {
+        return compressedTextureFormats & (1u << static_cast<uint32_t>(format));
+    }
+
     bool supportsPixelLocalStorage = true;
     bool supportsRasterOrdering = true;     // Can pixel local storage accesses be raster ordered?
     bool supportsKHRBlendEquations = false; // Use KHR_blend_equation_advanced in depthStencil mode?
@@ -109,6 +153,8 @@ struct PlatformFeatures
                                                    // "DrawType::plsAtomicInitialize" draw instead.
     uint8_t pathIDGranularity = 1; // Workaround for precision issues. Determines how far apart we
                                    // space unique path IDs.
+    uint8_t compressedTextureFormats = 0; // Mask of (1 << CompressedTextureFormat) for formats that
+                                          // can be uploaded without decompression.
 };
 
 // Gradient color stops are implemented as a horizontal span of pixels in a global gradient
@@ -674,7 +720,12 @@ struct DrawBatch
     // DrawType::imageMesh.
     const RenderBuffer* vertexBuffer;
     const RenderBuffer* uvBuffer;
+    // DrawType::imageMesh (uint16_t indices) and DrawType::interiorTriangulation (uint32_t indices
+    // into the triangle vertex buffer).
     const RenderBuffer* indexBuffer;
+    // Byte offset of the mesh's data within vertexBuffer and uvBuffer. (Nonzero for streamed
+    // meshes, which share the render context's per-frame mesh buffers.)
+    uint32_t vertexDataOffsetInBytes = 0;
 };
 
 // Simple gradients only have 2 texels, so we write them to mapped texture memory from the CPU
@@ -743,6 +794,11 @@ struct FlushDescriptor
 
     void* externalCommandBuffer = nullptr; // Required on Metal.
     bool isFinalFlushOfFrame = false;
+
+#ifdef RIVE_PLS_STATS
+    uint64_t frameNumber = 0;         // PLSRenderContext::FrameStats::frameNumber.
+    bool gpuDrawBatchTimings = false; // FrameDescriptor::gpuDrawBatchTimings.
+#endif
 };
 
 // Returns true if the PLS shaders emit color directly to the raster pipeline, instead of rendering
@@ -1085,6 +1141,10 @@ public:
     }
     void skip_back() { push(); }
 
+    // Reserves 'count' items at the end of the buffer and returns a pointer to them, for clients
+    // that generate their data directly into mapped memory. The returned memory is write-only.
+    T* alloc_back_n(size_t count) { return push(count); }
+
 private:
     RIVE_ALWAYS_INLINE T& push()
     {
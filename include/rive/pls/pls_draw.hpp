@@ -64,6 +64,10 @@ public:
     void setClipID(uint32_t clipID);
     void setClipRect(const pls::ClipRectInverseMatrix* m) { m_clipRectInverseMatrix = m; }
 
+    // Takes over the clip and paint state that was assigned to 'draw' (clip ID, clip rect, and
+    // gradient location), so this draw can be pushed in its place.
+    void inheritFlushState(const PLSDraw& draw);
+
     // Used to allocate GPU resources for a collection of draws.
     using ResourceCounters = PLSRenderContext::LogicalFlush::ResourceCounters;
     const ResourceCounters& resourceCounts() const { return m_resourceCounts; }
@@ -128,6 +132,14 @@ public:
                                  const PLSPaint*,
                                  RawPath* scratchPath);
 
+    // Creates an interior triangulation that fills 'outline' (a stroke that was already converted
+    // to a nonZero fill on the CPU) with the stroke's paint.
+    static PLSDrawUniquePtr MakeStrokeOutline(PLSRenderContext*,
+                                              const Mat2D&,
+                                              rcp<const PLSPath> outline,
+                                              const PLSPaint*,
+                                              RawPath* scratchPath);
+
     FillRule fillRule() const { return m_fillRule; }
     pls::PaintType paintType() const { return m_paintType; }
     float strokeRadius() const { return m_strokeRadius; }
@@ -138,11 +150,13 @@ public:
     void releaseRefs() override;
 
 public:
+    // 'isStroked' is false when 'paint' is a stroke whose outline was already converted to a fill.
     PLSPathDraw(IAABB pathBounds,
                 const Mat2D&,
                 rcp<const PLSPath>,
                 FillRule,
                 const PLSPaint*,
+                bool isStroked,
                 Type,
                 pls::InterlockMode);
 
@@ -162,12 +176,14 @@ public:
 class MidpointFanPathDraw : public PLSPathDraw
 {
 public:
+    // 'isStroked' is false when 'paint' is a stroke whose outline was already converted to a fill.
     MidpointFanPathDraw(PLSRenderContext*,
                         IAABB pixelBounds,
                         const Mat2D&,
                         rcp<const PLSPath>,
                         FillRule,
-                        const PLSPaint*);
+                        const PLSPaint*,
+                        bool isStroked);
 
 protected:
     void onPushToRenderContext(PLSRenderContext::LogicalFlush*) override;
@@ -180,12 +196,22 @@ protected:
                                                 uint32_t emulatedCapAsJoinFlags,
                                                 uint32_t strokeCapSegmentCount);
 
+    // Hairlines emit round joins as bevels, so they never measure rotations for joins. Miter joins
+    // are kept. (Empty contours still choose their caps from the paint's join.)
+    StrokeJoin emittedStrokeJoin() const
+    {
+        return m_hairline && m_strokeJoin == StrokeJoin::round ? StrokeJoin::bevel : m_strokeJoin;
+    }
+
     float m_strokeMatrixMaxScale;
     StrokeJoin m_strokeJoin;
     StrokeCap m_strokeCap;
+    bool m_hairline = false; // Stroke is no wider than half a device pixel.
 
     struct ContourInfo
     {
+        // Contours are not necessarily contiguous; offscreen contours get culled.
+        RawPath::Iter startOfContour;
         RawPath::Iter endOfContour;
         size_t endLineIdx;
         size_t firstCurveIdx;
@@ -238,7 +264,44 @@ public:
                               RawPath* scratchPath,
                               TriangulatorAxis);
 
-    GrInnerFanTriangulator* triangulator() const { return m_triangulator; }
+    // Not valid until the triangulation has been resolved.
+    GrInnerFanTriangulator* triangulator() const
+    {
+        assert(m_triangulationJob == nullptr);
+        return m_triangulator;
+    }
+
+    // Is the triangulation still running on a worker thread? If so, resourceCounts() don't account
+    // for its triangles yet. Instead they hold a reservation that covers both an estimate of its
+    // grout patches and a midpoint fan fallback of the same path.
+    bool hasPendingTriangulation() const { return m_triangulationJob != nullptr; }
+
+    // Waits for the worker thread to finish triangulating, and replaces the reservation in
+    // resourceCounts() with the actual triangles and grout.
+    void resolvePendingTriangulation(PLSRenderContext*);
+
+    // Did the worker thread produce more grout than the reservation has room for? If so, a
+    // LogicalFlush that was filled up while the triangulation was pending may not have room for
+    // this draw, and must replace it with takeMidpointFanFallback().
+    bool overranReservation() const { return m_overranReservation; }
+
+    // Returns a midpoint fan draw of the same path, with this draw's clip and paint state. Its
+    // resources always fit in the reservation.
+    PLSDrawUniquePtr takeMidpointFanFallback();
+
+    // Was the whole path flattened and triangulated on the CPU? (See flattenPath().)
+    bool isFlattenedTriangulation() const { return m_isFlattenedTriangulation; }
+
+    // Number of points handed to the triangulator (0 for convex fans). Flattened paths have many
+    // more points than the original, so this is what triangulation time gets measured against.
+    size_t triangulatedPointCount() const { return m_triangulatedPointCount; }
+
+    // Writes the interior triangles as an indexed triangle list and returns the number of indices.
+    size_t writeInteriorTriangles(WriteOnlyMappedMemory<TriangleVertex>* vertexBufferRing,
+                                  WriteOnlyMappedMemory<uint32_t>* indexBufferRing,
+                                  uint16_t pathID) const;
+
+    void releaseRefs() override;
 
 protected:
     void onPushToRenderContext(PLSRenderContext::LogicalFlush*) override;
@@ -253,32 +316,82 @@ protected:
         (kMaxParametricSegments + kPatchSegmentCountExcludingJoin - 1) /
         kPatchSegmentCountExcludingJoin;
 
-    static size_t FindSubdivisionCount(const Vec2D pts[],
-                                       const wangs_formula::VectorXform& vectorXform)
+    // Cubics that need more than kMaxCurveSubdivisions patches get split in half (instead of
+    // clamped), recursively, up to this many times.
+    constexpr static int kMaxHugeCubicSplitDepth = 8;
+
+    // Returns the number of outerCurve patches the cubic needs. May exceed kMaxCurveSubdivisions,
+    // in which case the cubic gets split before subdividing.
+    static float FindUnclampedSubdivisionCount(const Vec2D pts[],
+                                               const wangs_formula::VectorXform& vectorXform)
     {
-        size_t numSubdivisions =
-            ceilf(wangs_formula::cubic(pts, kParametricPrecision, vectorXform) *
-                  (1.f / kPatchSegmentCountExcludingJoin));
-        return std::clamp<size_t>(numSubdivisions, 1, kMaxCurveSubdivisions);
+        return ceilf(wangs_formula::cubic(pts, kParametricPrecision, vectorXform) *
+                     (1.f / kPatchSegmentCountExcludingJoin));
     }
 
     enum class PathOp : bool
     {
-        countDataAndTriangulate,
+        countDataAndLinearize,
         submitOuterCubics,
     };
 
-    // For now, we just iterate and subdivide the path twice (once for each enum in PathOp).
-    // Since we only do this for large paths, and since we're triangulating the path interior
-    // anyway, adding complexity to only run Wang's formula and chop once would save about ~5%
-    // of the total CPU time. (And large paths are GPU-bound anyway.)
+    // We iterate the path twice (once for each enum in PathOp). The first pass runs Wang's formula
+    // and chops every cubic, recording the results in m_subdividedCubics, and writes the inner
+    // polygon to 'innerPolygon'; the second pass replays those recordings instead of subdividing
+    // again. The first pass also flattens cubics that fall entirely outside the render target,
+    // since their tessellation is never seen.
     void processPath(PathOp op,
-                     TrivialBlockAllocator*,
-                     RawPath* scratchPath,
-                     TriangulatorAxis,
+                     PLSRenderContext*, // Only used by countDataAndLinearize.
+                     RawPath* innerPolygon,
                      PLSRenderContext::LogicalFlush*);
 
+    // depthStencil mode has no way to combine interior triangles with outerCurve patches, so it
+    // instead flattens the curves on the CPU and triangulates the entire path. The resulting
+    // triangles cover exactly the path's filled area, without overlap, so they can be drawn
+    // directly with no stencil pass. (MSAA antialiases the edges.)
+    void flattenPath(PLSRenderContext*, RawPath* flattenedPath);
+
+    // Replaces the outer curve counts in m_resourceCounts with a reservation for a triangulation
+    // that is still running on a worker thread. (See hasPendingTriangulation().)
+    void reserveRoomForPendingTriangulation(PLSRenderContext*,
+                                            const PLSPaint*,
+                                            size_t innerPolygonPointCount);
+
+    // Adds the triangles (and grout patches) from m_triangulator to m_resourceCounts, in place of
+    // the reservation (if any).
+    void countTriangulationResources();
+
+    // Adds the given number of grout patches to m_resourceCounts.
+    void countGroutPatches(size_t groutCount);
+
+    // If the inner polygon is a single convex contour, records it as a triangle fan (which doesn't
+    // need the triangulator, or any grout) and returns true.
+    bool tryConvexFan(PLSRenderContext*, const RawPath& innerPolygon);
+
+    // A cubic from the path, subdivided into outerCurve patches.
+    struct SubdividedCubic
+    {
+        const Vec2D* pts; // numSubdivisions * 3 + 1 points.
+        uint32_t numSubdivisions;
+    };
+
     GrInnerFanTriangulator* m_triangulator = nullptr;
+    InteriorTriangulationJob* m_triangulationJob = nullptr; // Non-null until resolved.
+
+    // Drawn instead if a pending triangulation overruns its reservation. Null once resolved
+    // without overrunning.
+    MidpointFanPathDraw* m_midpointFanFallback = nullptr;
+    // Resource counts for the outer curves alone, while m_resourceCounts holds the reservation.
+    ResourceCounters m_countsWithoutReservation;
+    bool m_overranReservation = false;
+    SubdividedCubic* m_subdividedCubics = nullptr; // One per cubic in the path, in order.
+    bool m_isFlattenedTriangulation = false;       // See flattenPath().
+    size_t m_triangulatedPointCount = 0;
+
+    // Set instead of m_triangulator when the inner polygon is convex.
+    const Vec2D* m_convexFanPoints = nullptr;
+    uint32_t m_convexFanPointCount = 0;
+    int16_t m_convexFanWeight = 0; // Winding weight of every triangle in the fan.
 };
 
 // Pushes an imageRect to the render context.
@@ -302,6 +415,30 @@ protected:
     const float m_opacity;
 };
 
+// Client-provided mesh whose data gets written directly into the render context's per-frame GPU
+// buffers while they are mapped during PLSRenderContext::flush(). This avoids a persistent
+// RenderBuffer (and its extra copy and ring allocation) for meshes that change every frame, e.g.,
+// CPU skinning can deform vertices straight into mapped GPU memory.
+//
+// The mesh is ref'd until the flush completes. Its vertex and index counts may not change in the
+// meantime.
+class StreamedImageMesh : public RefCnt<StreamedImageMesh>
+{
+public:
+    virtual ~StreamedImageMesh() {}
+
+    virtual uint32_t vertexCount() const = 0;
+    virtual uint32_t indexCount() const = 0;
+
+    // Writes exactly vertexCount() positions and uvs. The destination is mapped GPU memory: only
+    // write to it, never read it back.
+    virtual void writeVertices(Vec2D positions[], Vec2D uvs[]) const = 0;
+
+    // Writes exactly indexCount() indices, relative to the first vertex of this mesh. The
+    // destination is mapped GPU memory: only write to it, never read it back.
+    virtual void writeIndices(uint16_t indices[]) const = 0;
+};
+
 // Pushes an imageMesh to the render context.
 class ImageMeshDraw : public PLSDraw
 {
@@ -316,9 +453,19 @@ public:
                   uint32_t indexCount,
                   float opacity);
 
+    // Draws a StreamedImageMesh, whose data gets written into the render context's own buffers
+    // from pushToRenderContext().
+    ImageMeshDraw(IAABB pixelBounds,
+                  const Mat2D&,
+                  BlendMode,
+                  rcp<const PLSTexture>,
+                  rcp<const StreamedImageMesh>,
+                  float opacity);
+
     const RenderBuffer* vertexBuffer() const { return m_vertexBufferRef; }
     const RenderBuffer* uvBuffer() const { return m_uvBufferRef; }
     const RenderBuffer* indexBuffer() const { return m_indexBufferRef; }
+    const StreamedImageMesh* streamedMesh() const { return m_streamedMeshRef; }
     uint32_t indexCount() const { return m_indexCount; }
     float opacity() const { return m_opacity; }
 
@@ -327,9 +474,11 @@ public:
     void releaseRefs() override;
 
 protected:
+    // Either the three RenderBuffers or m_streamedMeshRef are set, but not both.
     const RenderBuffer* const m_vertexBufferRef;
     const RenderBuffer* const m_uvBufferRef;
     const RenderBuffer* const m_indexBufferRef;
+    const StreamedImageMesh* const m_streamedMeshRef;
     const uint32_t m_indexCount;
     const float m_opacity;
 };
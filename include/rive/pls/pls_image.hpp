@@ -64,4 +64,22 @@ protected:
 private:
     rcp<PLSTexture> m_texture;
 };
+
+// PLSImage whose pixels are decoded on a worker thread (see PLSRenderContext::decodeImageAsync()).
+// Until the decode finishes, the image has a width and height of 0, has no texture, and does not
+// draw.
+class PLSAsyncImage : public PLSImage
+{
+public:
+    PLSAsyncImage() : PLSImage(0, 0) {}
+
+    // Called on the render thread once the pixels have been decoded and uploaded.
+    void resolveTexture(rcp<PLSTexture> texture)
+    {
+        assert(getTexture() == nullptr);
+        m_Width = texture->width();
+        m_Height = texture->height();
+        resetTexture(std::move(texture));
+    }
+};
 } // namespace rive::pls
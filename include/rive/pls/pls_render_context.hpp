@@ -13,6 +13,18 @@
 #include <array>
 #include <unordered_map>
 
+#ifdef RIVE_PLS_STATS
+#include <chrono>
+#endif
+
+// Compiles its argument only when the renderer is built with frame stats (RIVE_PLS_STATS, i.e.,
+// premake5 --with-pls-stats).
+#ifdef RIVE_PLS_STATS
+#define RIVE_PLS_STATS_CODE(...) __VA_ARGS__
+#else
+#define RIVE_PLS_STATS_CODE(...)
+#endif
+
 class PushRetrofittedTrianglesGMDraw;
 class PLSRenderContextTest;
 
@@ -28,13 +40,16 @@ class IntersectionBoard;
 class ImageMeshDraw;
 class ImageRectDraw;
 class InteriorTriangulationDraw;
+class InteriorTriangulationJob;
 class MidpointFanPathDraw;
 class StencilClipReset;
+class WorkerPool;
 class PLSDraw;
 class PLSGradient;
 class PLSPaint;
 class PLSPath;
 class PLSPathDraw;
+class PLSAsyncImage;
 class PLSRenderContextImpl;
 
 // Used as a key for complex gradients.
@@ -109,6 +124,35 @@ public:
         bool disableRasterOrdering = false; // Use atomic mode in place of rasterOrdering, even if
                                             // rasterOrdering is supported.
 
+        // Filled paths that cover more than this many pixels on screen get their interiors
+        // triangulated on the CPU, instead of being drawn as midpoint fans. Devices with slow CPUs
+        // or fast fill rates may want to raise it.
+        float interiorTriangulationMinArea = 512 * 512;
+
+        // If true, interiorTriangulationMinArea is ignored and each filled path picks between a
+        // midpoint fan and interior triangulation by comparing its on-screen area (which is what
+        // the fan's overdraw costs) against its point count (which is what triangulating costs).
+        // The CPU side of that tradeoff is measured as paths get triangulated. Paths that cover
+        // 128x128 pixels or less always use a midpoint fan.
+        bool adaptiveInteriorTriangulation = false;
+        // Estimated GPU time that interior triangulation saves for each pixel a path covers. Only
+        // used when adaptiveInteriorTriangulation is true.
+        float fanOverdrawNanosPerPixel = .075f;
+
+        // Triangulate path interiors on the render thread, as opposed to on worker threads that
+        // run while the rest of the frame is being built up.
+        bool synchronousInteriorTriangulation = false;
+
+        // Strokes at least this many pixels wide get converted to fills on the CPU, so their
+        // interiors can be triangulated instead of overdrawn by stroke triangles. (They still have
+        // to be large enough on screen to pass the interior triangulation threshold.) Bold outline
+        // artwork tends to be fill-rate bound on mobile. Zero disables the conversion.
+        float strokeTriangulationMinWidth = 0;
+
+        // Ask the backend to time each DrawBatch on the GPU, in addition to each stage of the
+        // flush. (Only in builds with RIVE_PLS_STATS, on backends that support timer queries.)
+        RIVE_PLS_STATS_CODE(bool gpuDrawBatchTimings = false;)
+
         // Testing flags.
         bool wireframe = false;
         bool fillsDisabled = false;
@@ -126,6 +170,10 @@ public:
         return m_frameDescriptor;
     }
 
+    // Counts up from 1 with every beginFrame(). Every draw from a previous frame has released its
+    // references by the time this changes, so clients can use it to recycle per-frame objects.
+    uint64_t frameCount() const { return m_frameCount; }
+
     // True if bounds is empty or outside [0, 0, renderTargetWidth, renderTargetHeight].
     bool isOutsideCurrentFrame(const IAABB& pixelBounds);
 
@@ -140,6 +188,13 @@ public:
 
     const pls::InterlockMode frameInterlockMode() const { return m_frameInterlockMode; }
 
+    // Should a filled path with the given on-screen area and point count be drawn with interior
+    // triangulation (as opposed to a midpoint fan)? Decided by the current FrameDescriptor.
+    bool shouldTriangulateInterior(float pixelArea, size_t pointCount) const;
+
+    // Reports how long it took to triangulate a path, for adaptiveInteriorTriangulation.
+    void recordInteriorTriangulationTime(double seconds, size_t pointCount);
+
     // Generates a unique clip ID that is guaranteed to not exist in the current clip buffer, and
     // assigns a contentBounds to it.
     //
@@ -209,6 +264,88 @@ public:
     // with this render context.
     void releaseResources();
 
+#ifdef RIVE_PLS_STATS
+    // Why a logical flush was issued before the end of the frame.
+    enum class LogicalFlushReason
+    {
+        requested,         // The client called logicalFlush() on its own.
+        pathIDs,           // Ran out of path IDs.
+        contourIDs,        // Ran out of contour IDs.
+        tessTextureHeight, // The tessellation texture was full.
+        gradientRows,      // The gradient texture was full.
+        clipIDs,           // Ran out of clip IDs.
+        reorderLimit,      // Atomic mode can't reorder more draws at once.
+    };
+    constexpr static size_t kLogicalFlushReasonCount = 7;
+
+    // Where a frame's CPU time went, and how it was split up for the GPU.
+    struct FrameStats
+    {
+        uint64_t frameNumber = 0; // Counts up from 1 with every beginFrame().
+
+        // CPU time spent in each stage of the frame, in nanoseconds. Draw construction is the time
+        // spent in PLSRenderer's draw calls, which includes gradient allocation. Writing resources
+        // includes sorting and reordering draws.
+        uint64_t drawConstructionNanos = 0;
+        uint64_t gradientAllocationNanos = 0;
+        uint64_t layoutResourcesNanos = 0;
+        uint64_t sortAndReorderNanos = 0;
+        uint64_t writeResourcesNanos = 0;
+        uint64_t mapUnmapNanos = 0;
+
+        // Every frame has at least one logical flush. Each additional one is tallied by the reason
+        // the flush before it had to end.
+        uint32_t logicalFlushCount = 0;
+        std::array<uint32_t, kLogicalFlushReasonCount> logicalFlushReasons{};
+
+        uint32_t drawBatchCount = 0; // DrawBatches submitted to the backend.
+        uint32_t barrierCount = 0;   // Barriers between DrawBatches.
+    };
+
+    // Stats for the most recent frame that was flushed.
+    const FrameStats& lastFrameStats() const { return m_lastFrameStats; }
+
+    // Where a frame's GPU time went, in nanoseconds, summed across its logical flushes.
+    struct GPUFrameStats
+    {
+        uint64_t frameNumber = 0; // The FrameStats::frameNumber these timings belong to.
+
+        uint64_t colorRampNanos = 0;      // Rendering complex gradients.
+        uint64_t simpleGradientNanos = 0; // Uploading simple gradients.
+        uint64_t tessellationNanos = 0;
+        uint64_t drawListNanos = 0;
+
+        // Time spent in each DrawBatch that issued draws, in submission order. Only populated when
+        // FrameDescriptor::gpuDrawBatchTimings is set, in which case drawListNanos is the sum of
+        // these, and doesn't include the time spent setting up and resolving the render target.
+        std::vector<uint64_t> drawBatchNanos;
+    };
+
+    // GPU timings are read back asynchronously, so they lag a few frames behind lastFrameStats().
+    // Returns the timings for the most recent frame whose results have arrived, or null if there
+    // aren't any yet, or if the backend doesn't support timer queries.
+    const GPUFrameStats* lastGPUFrameStats() const;
+
+    // Adds the time between its construction and destruction to one of the current frame's stats.
+    class ScopedStatsTimer
+    {
+    public:
+        ScopedStatsTimer(PLSRenderContext* context, uint64_t FrameStats::*stat) :
+            m_stat(&(context->m_frameStats.*stat)), m_startTime(std::chrono::steady_clock::now())
+        {}
+
+        ~ScopedStatsTimer()
+        {
+            auto elapsed = std::chrono::steady_clock::now() - m_startTime;
+            *m_stat += std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count();
+        }
+
+    private:
+        uint64_t* const m_stat;
+        const std::chrono::steady_clock::time_point m_startTime;
+    };
+#endif
+
     // Returns the context's TrivialBlockAllocator, which is automatically reset at the end of every
     // frame. (Memory in this allocator is preserved between logical flushes.)
     TrivialBlockAllocator& perFrameAllocator()
@@ -245,6 +382,12 @@ public:
     rcp<RenderBuffer> makeRenderBuffer(RenderBufferType, RenderBufferFlags, size_t) override;
     rcp<RenderImage> decodeImage(Span<const uint8_t>) override;
 
+    // Like decodeImage(), but decodes on a worker thread and returns immediately, so loading many
+    // images doesn't stall the render thread. The returned image is empty (0x0, and draws nothing)
+    // until the first beginFrame() after its decode finishes, at which point its texture is
+    // created. If the bytes can't be decoded, the image stays empty.
+    rcp<RenderImage> decodeImageAsync(Span<const uint8_t>);
+
 private:
     friend class PLSDraw;
     friend class PLSPathDraw;
@@ -263,7 +406,7 @@ private:
     // LogicalFlush::ResourceCounters and LogicalFlush::LayoutCounters.
     struct ResourceAllocationCounts
     {
-        using VecType = simd::gvec<size_t, 12>;
+        using VecType = simd::gvec<size_t, 15>;
 
         RIVE_ALWAYS_INLINE VecType toVec() const
         {
@@ -291,10 +434,21 @@ private:
         size_t complexGradSpanBufferCount = 0;
         size_t tessSpanBufferCount = 0;
         size_t triangleVertexBufferCount = 0;
+        size_t triangleIndexBufferCount = 0;
+        size_t streamedMeshVertexBufferCount = 0;
+        size_t streamedMeshIndexBufferCount = 0;
         size_t gradTextureHeight = 0;
         size_t tessTextureHeight = 0;
     };
 
+    // Creates textures for any images whose asynchronous decodes have finished.
+    void resolveFinishedImageDecodes();
+
+    // Starts an interior triangulation on a worker thread. The context owns the job until the end
+    // of the frame.
+    InteriorTriangulationJob* runInteriorTriangulationJob(
+        std::unique_ptr<InteriorTriangulationJob>);
+
     // Reallocates GPU resources and updates m_currentResourceAllocations.
     // If forceRealloc is true, every GPU resource is allocated, even if the size would not change.
     void setResourceSizes(ResourceAllocationCounts, bool forceRealloc = false);
@@ -305,6 +459,23 @@ private:
     const std::unique_ptr<PLSRenderContextImpl> m_impl;
     const size_t m_maxPathID;
 
+    // State for decodeImageAsync(). Declared after m_impl so the workers get joined before m_impl
+    // is destroyed.
+    struct ImageDecodeJob;
+    struct PendingImageDecode
+    {
+        rcp<PLSAsyncImage> image;
+        std::shared_ptr<ImageDecodeJob> job;
+    };
+    std::vector<PendingImageDecode> m_pendingImageDecodes;
+    std::unique_ptr<WorkerPool> m_imageDecodeWorkers;
+
+    // Interior triangulations for the current frame. The workers are declared after the jobs so
+    // they get joined before the jobs are destroyed. They don't share a pool with image decodes,
+    // since a frame can't flush until its triangulations have finished.
+    std::vector<std::unique_ptr<InteriorTriangulationJob>> m_interiorTriangulationJobs;
+    std::unique_ptr<WorkerPool> m_interiorTriangulationWorkers;
+
     ResourceAllocationCounts m_currentResourceAllocations;
     ResourceAllocationCounts m_maxRecentResourceRequirements;
     double m_lastResourceTrimTimeInSeconds;
@@ -314,10 +485,29 @@ private:
     pls::InterlockMode m_frameInterlockMode;
     pls::ShaderFeatures m_frameShaderFeaturesMask;
     RIVE_DEBUG_CODE(bool m_didBeginFrame = false;)
+    uint64_t m_frameCount = 0;
+
+    // Running average of the CPU time it takes to triangulate a path, per point, for
+    // adaptiveInteriorTriangulation. Persists across frames.
+    //
+    // The average only gets measured when paths are triangulated, so a few slow triangulations
+    // could push every path to a midpoint fan for good. To avoid that, every frame moves the
+    // average 1/kInteriorTriangulationDecayFrames of the way back to its initial value, and
+    // eventually paths get triangulated (and measured) again.
+    constexpr static float kInitialInteriorTriangulationNanosPerPoint = 100;
+    constexpr static float kInteriorTriangulationDecayFrames = 64;
+    float m_interiorTriangulationNanosPerPoint = kInitialInteriorTriangulationNanosPerPoint;
+
+    // With adaptiveInteriorTriangulation, paths that cover this many pixels or fewer never have
+    // enough overdraw to be worth a trip through the triangulator.
+    constexpr static float kMinAdaptiveInteriorTriangulationArea = 128 * 128;
 
     // Clipping state.
     uint32_t m_clipContentID = 0;
 
+    RIVE_PLS_STATS_CODE(FrameStats m_frameStats;)
+    RIVE_PLS_STATS_CODE(FrameStats m_lastFrameStats;)
+
     // Used by LogicalFlushes for re-ordering high level draws.
     std::vector<int64_t> m_indirectDrawList;
     std::unique_ptr<IntersectionBoard> m_intersectionBoard;
@@ -333,6 +523,18 @@ private:
     WriteOnlyMappedMemory<pls::GradientSpan> m_gradSpanData;
     WriteOnlyMappedMemory<pls::TessVertexSpan> m_tessSpanData;
     WriteOnlyMappedMemory<pls::TriangleVertex> m_triangleVertexData;
+    // Interior triangulations are drawn indexed, so monotone polygons can share vertices. Like the
+    // streamed mesh buffers below, this is an ordinary RenderBuffer that every backend can bind.
+    rcp<RenderBuffer> m_triangleIndexBuffer;
+    WriteOnlyMappedMemory<uint32_t> m_triangleIndexData;
+    // StreamedImageMeshes write their data directly into these per-frame buffers. They are ordinary
+    // RenderBuffers, so every backend can already bind them for DrawType::imageMesh.
+    rcp<RenderBuffer> m_streamedMeshVertexBuffer;
+    rcp<RenderBuffer> m_streamedMeshUVBuffer;
+    rcp<RenderBuffer> m_streamedMeshIndexBuffer;
+    WriteOnlyMappedMemory<Vec2D> m_streamedMeshVertexData;
+    WriteOnlyMappedMemory<Vec2D> m_streamedMeshUVData;
+    WriteOnlyMappedMemory<uint16_t> m_streamedMeshIndexData;
     WriteOnlyMappedMemory<pls::ImageDrawUniforms> m_imageDrawUniformData;
 
     // Simple allocator for trivially-destructible data that needs to persist until the current
@@ -414,23 +616,31 @@ private:
         // point the context must append a new logical flush and try again.
         [[nodiscard]] bool pushDrawBatch(PLSDrawUniquePtr draws[], size_t drawCount);
 
+        // Waits for any triangulations that are still running on worker threads, and adds their
+        // final resource counts to m_resourceCounts.
+        void resolvePendingInteriorTriangulations();
+
+        // Waits for the InteriorTriangulationDraw's triangulation. If it overran its reservation,
+        // replaces the draw with its midpoint fan fallback.
+        void resolveInteriorTriangulation(PLSDrawUniquePtr*);
+
         // Running counts of data records required by PLSDraws that need to be allocated in the
         // render context's various GPU buffers.
         struct ResourceCounters
         {
-            using VecType = simd::gvec<size_t, 8>;
+            using VecType = simd::gvec<size_t, 11>;
 
             VecType toVec() const
             {
-                static_assert(sizeof(VecType) == sizeof(*this));
+                static_assert(sizeof(VecType) >= sizeof(*this));
                 VecType vec;
-                RIVE_INLINE_MEMCPY(&vec, this, sizeof(VecType));
+                RIVE_INLINE_MEMCPY(&vec, this, sizeof(*this));
                 return vec;
             }
 
             ResourceCounters(const VecType& vec)
             {
-                static_assert(sizeof(*this) == sizeof(VecType));
+                static_assert(sizeof(VecType) >= sizeof(*this));
                 RIVE_INLINE_MEMCPY(this, &vec, sizeof(*this));
             }
 
@@ -442,8 +652,11 @@ private:
             size_t contourCount = 0;
             size_t maxTessellatedSegmentCount = 0; // lines, curves, lone joins, emulated caps, etc.
             size_t maxTriangleVertexCount = 0;
+            size_t maxTriangleIndexCount = 0;
             size_t imageDrawCount = 0; // imageRect or imageMesh.
             size_t complexGradientSpanCount = 0;
+            size_t streamedMeshVertexCount = 0;
+            size_t streamedMeshIndexCount = 0;
         };
 
         // Additional counters for layout state that don't need to be tracked by individual draws.
@@ -603,6 +816,10 @@ private:
         std::vector<PLSDrawUniquePtr> m_plsDraws;
         IAABB m_combinedDrawBounds;
 
+        // Indices of draws in m_plsDraws whose triangulations aren't accounted for in
+        // m_resourceCounts yet.
+        std::vector<size_t> m_pendingInteriorTriangulations;
+
         // Layout state.
         uint32_t m_pathPaddingCount;
         uint32_t m_paintPaddingCount;
@@ -636,6 +853,10 @@ private:
         uint32_t m_currentZIndex;
 
         RIVE_DEBUG_CODE(bool m_hasDoneLayout = false;)
+
+        // Why the next call to PLSRenderContext::logicalFlush() is happening. Set when a draw or
+        // clip doesn't fit in this flush.
+        RIVE_PLS_STATS_CODE(LogicalFlushReason m_flushReason = LogicalFlushReason::requested;)
     };
 
     std::vector<std::unique_ptr<LogicalFlush>> m_logicalFlushes;
@@ -15,6 +15,8 @@ class PLSRenderContextHelperImpl : public PLSRenderContextImpl
 {
 public:
     rcp<PLSTexture> decodeImageTexture(Span<const uint8_t> encodedBytes) override;
+    bool decodeImagePixels(Span<const uint8_t> encodedBytes, DecodedImage*) override;
+    rcp<PLSTexture> makeDecodedImageTexture(const DecodedImage&) override;
 
     void resizeFlushUniformBuffer(size_t sizeInBytes) override;
     void resizeImageDrawUniformBuffer(size_t sizeInBytes) override;
@@ -46,8 +48,8 @@ public:
     void unmapContourBuffer() override;
     void unmapSimpleColorRampsBuffer() override;
     void unmapGradSpanBuffer() override;
-    void unmapTessVertexSpanBuffer() override;
-    void unmapTriangleVertexBuffer() override;
+    void unmapTessVertexSpanBuffer(size_t bytesWritten) override;
+    void unmapTriangleVertexBuffer(size_t bytesWritten) override;
 
     double secondsNow() const override
     {
@@ -72,6 +74,17 @@ protected:
                                              uint32_t mipLevelCount,
                                              const uint8_t imageDataRGBA[]) = 0;
 
+    // Creates a texture from block-compressed mip levels (largest first) without decompressing
+    // them. Only called for formats in PlatformFeatures::compressedTextureFormats.
+    virtual rcp<PLSTexture> makeCompressedImageTexture(uint32_t width,
+                                                       uint32_t height,
+                                                       pls::CompressedTextureFormat,
+                                                       const Span<const uint8_t> mipLevels[],
+                                                       uint32_t mipLevelCount)
+    {
+        return nullptr;
+    }
+
     virtual std::unique_ptr<BufferRing> makeUniformBufferRing(size_t capacityInBytes) = 0;
     virtual std::unique_ptr<BufferRing> makeStorageBufferRing(size_t capacityInBytes,
                                                               pls::StorageBufferStructure) = 0;
@@ -5,11 +5,21 @@
 #pragma once
 
 #include "rive/pls/pls_render_context.hpp"
+#include <memory>
 
 namespace rive::pls
 {
 class PLSTexture;
 
+// Image pixels that have been decoded on the CPU, but not yet uploaded to a texture.
+struct DecodedImage
+{
+    uint32_t width = 0;
+    uint32_t height = 0;
+    const uint8_t* pixelsRGBA = nullptr; // width * height * 4 bytes, owned by 'storage'.
+    std::shared_ptr<const void> storage; // Whatever the decoder decoded into (e.g., a Bitmap).
+};
+
 // This class manages GPU buffers and isues the actual rendering commands from PLSRenderContext.
 class PLSRenderContextImpl
 {
@@ -24,6 +34,14 @@ public:
     // image paint.
     virtual rcp<PLSTexture> decodeImageTexture(Span<const uint8_t> encodedBytes) = 0;
 
+    // Split version of decodeImageTexture() for asynchronous decoding.
+    //
+    // decodeImagePixels() only does CPU work and may be called from a worker thread. It returns
+    // false if the image could not be decoded. makeDecodedImageTexture() uploads the result and is
+    // called on the render thread.
+    virtual bool decodeImagePixels(Span<const uint8_t> encodedBytes, DecodedImage*) = 0;
+    virtual rcp<PLSTexture> makeDecodedImageTexture(const DecodedImage&) = 0;
+
     // Resize GPU buffers. These methods cannot fail, and must allocate the exact size requested.
     //
     // PLSRenderContext takes care to minimize how often these methods are called, while also
@@ -61,6 +79,10 @@ public:
     virtual void* mapTriangleVertexBuffer(size_t mapSizeInBytes) = 0;
 
     // Unmap GPU buffers. All buffers will be unmapped before flush().
+    //
+    // The tessellation span and triangle vertex buffers are mapped at a conservative, worst-case
+    // size. Their exact contents are only known once they have been written, so they also receive
+    // the number of bytes actually written, and only that many need to be uploaded.
     virtual void unmapFlushUniformBuffer() = 0;
     virtual void unmapImageDrawUniformBuffer() = 0;
     virtual void unmapPathBuffer() = 0;
@@ -69,8 +91,8 @@ public:
     virtual void unmapContourBuffer() = 0;
     virtual void unmapSimpleColorRampsBuffer() = 0;
     virtual void unmapGradSpanBuffer() = 0;
-    virtual void unmapTessVertexSpanBuffer() = 0;
-    virtual void unmapTriangleVertexBuffer() = 0;
+    virtual void unmapTessVertexSpanBuffer(size_t bytesWritten) = 0;
+    virtual void unmapTriangleVertexBuffer(size_t bytesWritten) = 0;
 
     // Allocate textures that the implementation is responsible to update during flush().
     virtual void resizeGradientTexture(uint32_t width, uint32_t height) = 0;
@@ -92,6 +114,12 @@ public:
     // Steady clock, used to determine when we should trim our resource allocations.
     virtual double secondsNow() const = 0;
 
+#ifdef RIVE_PLS_STATS
+    // Returns GPU timings for the most recent frame whose timer queries have resolved, or null if
+    // the backend doesn't time its flushes.
+    virtual const PLSRenderContext::GPUFrameStats* lastGPUFrameStats() const { return nullptr; }
+#endif
+
 protected:
     PlatformFeatures m_platformFeatures;
 };
@@ -18,6 +18,8 @@ class GrInnerFanTriangulator;
 
 namespace rive::pls
 {
+class PathDasher;
+class StrokeOutliner;
 class PLSPath;
 class PLSPaint;
 class PLSRenderContext;
@@ -33,6 +35,27 @@ public:
     void restore() override;
     void transform(const Mat2D& matrix) override;
     void drawPath(RenderPath*, RenderPaint*) override;
+
+    // Draws many paths with the same paint as a single merged draw, which saves the per-draw
+    // overhead (path/paint records, sorting, path IDs) of calling drawPath() on each one. Meant for
+    // glyph runs, icon grids, etc. If non-null, 'pathMatrices[i]' is applied to paths[i] before the
+    // current transform.
+    //
+    // The paths are filled or stroked as one shape, so translucent regions where they overlap only
+    // blend once. Paths only get merged if doing so doesn't change which pixels they cover: fills
+    // must all have the same fill rule and must not overlap, and strokes must only be translated
+    // (so their widths and dash lengths don't get scaled). Otherwise (or if any path isn't a
+    // PLSPath) they fall back to separate draws.
+    void drawPaths(RenderPath* const paths[],
+                   const Mat2D pathMatrices[],
+                   size_t count,
+                   RenderPaint*);
+
+    // Can drawPaths() merge these paths into a single draw without changing their coverage?
+    static bool canMergePaths(RenderPath* const paths[],
+                              const Mat2D pathMatrices[],
+                              size_t count,
+                              bool stroked);
     void clipPath(RenderPath*) override;
     void drawImage(const RenderImage*, BlendMode, float opacity) override;
     void drawImageMesh(const RenderImage*,
@@ -44,6 +67,14 @@ public:
                        BlendMode,
                        float opacity) override;
 
+    // Draws a mesh whose data gets written directly into the render context's per-frame GPU
+    // buffers during flush(), instead of being copied into RenderBuffers up front. (See
+    // StreamedImageMesh.)
+    void drawStreamedImageMesh(const RenderImage*,
+                               rcp<const StreamedImageMesh>,
+                               BlendMode,
+                               float opacity);
+
     // Determines if a path is an axis-aligned rectangle that can be represented by rive::AABB.
     static bool IsAABB(const RawPath&, AABB* result);
 
@@ -67,6 +98,15 @@ private:
     // and try again.
     [[nodiscard]] bool applyClip(PLSDraw*);
 
+    // canMergePaths() checks every pair of fills for overlap, so it gives up on larger batches.
+    constexpr static size_t kMaxFillsToMerge = 32;
+
+    // Returns an empty path for draws that generate their own geometry (e.g., dashes, outlines).
+    // Draws hold onto their paths until the end of the frame, so each call returns a different
+    // path, but they all get recycled (along with their memory) once the context begins a new
+    // frame.
+    rcp<PLSPath> makeScratchPath();
+
     struct RenderState
     {
         Mat2D matrix;
@@ -104,5 +144,16 @@ private:
 
     // Used to build coarse path interiors for the "interior triangulation" algorithm.
     RawPath m_scratchPath;
+
+    // Pool of paths handed out by makeScratchPath() during frame m_scratchPathsFrameCount.
+    std::vector<rcp<PLSPath>> m_scratchPaths;
+    size_t m_scratchPathsInUse = 0;
+    uint64_t m_scratchPathsFrameCount = 0;
+
+    // Splits dashed strokes into dashes. Created the first time we draw a dashed stroke.
+    std::unique_ptr<PathDasher> m_pathDasher;
+
+    // Converts very thick strokes into fills. Created the first time we need it.
+    std::unique_ptr<StrokeOutliner> m_strokeOutliner;
 };
 } // namespace rive::pls
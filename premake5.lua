@@ -120,6 +120,37 @@ do
     end
 end
 
+project('pls_unit_tests')
+do
+    dependson('rive')
+    kind('ConsoleApp')
+    includedirs({
+        'include',
+        'renderer',
+        RIVE_RUNTIME_DIR .. '/include',
+        RIVE_RUNTIME_DIR .. '/dev/test/include', -- Catch2.
+    })
+    flags({ 'FatalWarnings' })
+
+    files({ 'tests/unit_tests/**.cpp' })
+
+    links({
+        'rive_pls_renderer',
+        'rive',
+        'rive_decoders',
+        'libpng',
+        'zlib',
+        'rive_harfbuzz',
+        'rive_sheenbidi',
+    })
+
+    filter('system:windows')
+    do
+        architecture('x64')
+        defines({ 'RIVE_WINDOWS', '_CRT_SECURE_NO_WARNINGS' })
+    end
+end
+
 if _OPTIONS['with-webgpu'] or _OPTIONS['with-dawn'] then
     project('webgpu_player')
     do
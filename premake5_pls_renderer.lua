@@ -58,6 +58,17 @@ do
     defines({ 'RIVE_WEBGL' })
 end
 
+-- Define RIVE_PLS_STATS outside of a project as well, since it changes the layout of
+-- PLSRenderContext.
+newoption({
+    trigger = 'with-pls-stats',
+    description = 'collect per-frame CPU stats in PLSRenderContext (see FrameStats)',
+})
+filter({ 'options:with-pls-stats' })
+do
+    defines({ 'RIVE_PLS_STATS' })
+end
+
 filter({})
 
 -- Minify PLS shaders, and precompile them into metal libraries if targeting ios or macosx.
@@ -124,6 +124,11 @@ PLSRenderContextD3DImpl::PLSRenderContextD3DImpl(ComPtr<ID3D11Device> gpu,
 {
     m_platformFeatures.invertOffscreenY = true;
     m_platformFeatures.supportsRasterOrdering = d3dCapabilities.supportsRasterizerOrderedViews;
+    // BC1, BC3, and BC7 are all required at feature level 11.
+    m_platformFeatures.compressedTextureFormats =
+        1 << static_cast<int>(CompressedTextureFormat::bc1RGBA) |
+        1 << static_cast<int>(CompressedTextureFormat::bc3RGBA) |
+        1 << static_cast<int>(CompressedTextureFormat::bc7RGBA);
 
     // Create a default raster state for path and offscreen draws.
     D3D11_RASTERIZER_DESC rasterDesc;
@@ -528,6 +533,41 @@ public:
         plsImpl->gpuContext()->GenerateMips(m_srv.Get());
     }
 
+    PLSTextureD3DImpl(PLSRenderContextD3DImpl* plsImpl,
+                      UINT width,
+                      UINT height,
+                      DXGI_FORMAT compressedFormat,
+                      CompressedTextureFormat format,
+                      const Span<const uint8_t> mipLevels[],
+                      UINT mipLevelCount) :
+        PLSTexture(width, height)
+    {
+        m_texture = plsImpl->makeSimple2DTexture(compressedFormat,
+                                                 width,
+                                                 height,
+                                                 mipLevelCount,
+                                                 D3D11_BIND_SHADER_RESOURCE);
+
+        // Compressed textures can't generate mipmaps on the GPU, so upload every level as-is.
+        for (UINT level = 0; level < mipLevelCount; ++level)
+        {
+            UINT levelWidth = std::max(width >> level, 1u);
+            UINT blocksWide =
+                (levelWidth + kCompressedTextureBlockDim - 1) / kCompressedTextureBlockDim;
+            plsImpl->gpuContext()->UpdateSubresource(m_texture.Get(),
+                                                     level,
+                                                     NULL,
+                                                     mipLevels[level].data(),
+                                                     blocksWide *
+                                                         CompressedTextureBlockSizeInBytes(format),
+                                                     0);
+        }
+
+        VERIFY_OK(plsImpl->gpu()->CreateShaderResourceView(m_texture.Get(),
+                                                           NULL,
+                                                           m_srv.ReleaseAndGetAddressOf()));
+    }
+
     ID3D11ShaderResourceView* srv() const { return m_srv.Get(); }
     ID3D11ShaderResourceView* const* srvAddressOf() const { return m_srv.GetAddressOf(); }
 
@@ -544,6 +584,46 @@ rcp<PLSTexture> PLSRenderContextD3DImpl::makeImageTexture(uint32_t width,
     return make_rcp<PLSTextureD3DImpl>(this, width, height, mipLevelCount, imageDataRGBA);
 }
 
+static DXGI_FORMAT compressed_texture_dxgi_format(CompressedTextureFormat format)
+{
+    switch (format)
+    {
+        case CompressedTextureFormat::bc1RGBA:
+            return DXGI_FORMAT_BC1_UNORM;
+        case CompressedTextureFormat::bc3RGBA:
+            return DXGI_FORMAT_BC3_UNORM;
+        case CompressedTextureFormat::bc7RGBA:
+            return DXGI_FORMAT_BC7_UNORM;
+        case CompressedTextureFormat::etc2RGB8:
+        case CompressedTextureFormat::etc2RGBA8:
+        case CompressedTextureFormat::astc4x4RGBA:
+            break;
+    }
+    RIVE_UNREACHABLE();
+}
+
+rcp<PLSTexture> PLSRenderContextD3DImpl::makeCompressedImageTexture(
+    uint32_t width,
+    uint32_t height,
+    CompressedTextureFormat format,
+    const Span<const uint8_t> mipLevels[],
+    uint32_t mipLevelCount)
+{
+    assert(m_platformFeatures.supportsCompressedTextureFormat(format));
+    if (width % kCompressedTextureBlockDim != 0 || height % kCompressedTextureBlockDim != 0)
+    {
+        // D3D11 requires the top level of a block-compressed texture to be block aligned.
+        return nullptr;
+    }
+    return make_rcp<PLSTextureD3DImpl>(this,
+                                       width,
+                                       height,
+                                       compressed_texture_dxgi_format(format),
+                                       format,
+                                       mipLevels,
+                                       mipLevelCount);
+}
+
 class BufferRingD3D : public BufferRing
 {
 public:
@@ -583,9 +663,13 @@ protected:
         return shadowBuffer();
     }
 
-    void onUnmapAndSubmitBuffer(int bufferIdx, size_t mapSizeInBytes) override
+    void onUnmapAndSubmitBuffer(int bufferIdx, size_t updateSizeInBytes) override
     {
-        if (mapSizeInBytes == capacityInBytes())
+        if (updateSizeInBytes == 0)
+        {
+            return;
+        }
+        if (updateSizeInBytes == capacityInBytes())
         {
             // Constant buffers don't allow partial updates, so special-case the event where we
             // update the entire buffer.
@@ -596,7 +680,7 @@ protected:
         {
             D3D11_BOX box;
             box.left = 0;
-            box.right = mapSizeInBytes;
+            box.right = updateSizeInBytes;
             box.top = 0;
             box.bottom = 1;
             box.front = 0;
@@ -1435,9 +1519,11 @@ void PLSRenderContextD3DImpl::flush(const FlushDescriptor& desc)
             }
             case DrawType::interiorTriangulation:
             {
+                LITE_RTTI_CAST_OR_BREAK(indexBuffer, const RenderBufferD3DImpl*, batch.indexBuffer);
                 m_gpuContext->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+                m_gpuContext->IASetIndexBuffer(indexBuffer->buffer(), DXGI_FORMAT_R32_UINT, 0);
                 m_gpuContext->RSSetState(m_backCulledRasterState[desc.wireframe].Get());
-                m_gpuContext->Draw(batch.elementCount, batch.baseElement);
+                m_gpuContext->DrawIndexed(batch.elementCount, batch.baseElement, 0);
                 break;
             }
             case DrawType::imageRect:
@@ -1463,7 +1549,8 @@ void PLSRenderContextD3DImpl::flush(const FlushDescriptor& desc)
                 LITE_RTTI_CAST_OR_BREAK(indexBuffer, const RenderBufferD3DImpl*, batch.indexBuffer);
                 ID3D11Buffer* imageMeshBuffers[] = {vertexBuffer->buffer(), uvBuffer->buffer()};
                 UINT imageMeshStrides[] = {sizeof(Vec2D), sizeof(Vec2D)};
-                UINT imageMeshOffsets[] = {0, 0};
+                UINT imageMeshOffsets[] = {batch.vertexDataOffsetInBytes,
+                                           batch.vertexDataOffsetInBytes};
                 m_gpuContext->IASetVertexBuffers(kImageMeshVertexDataSlot,
                                                  2,
                                                  imageMeshBuffers,
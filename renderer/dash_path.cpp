@@ -0,0 +1,302 @@
+/*
+ * Copyright 2024 Rive
+ */
+
+#include "dash_path.hpp"
+
+#include "eval_cubic.hpp"
+#include "path_utils.hpp"
+#include "rive/math/wangs_formula.hpp"
+#include "rive/pls/pls.hpp"
+
+#include <algorithm>
+#include <string.h>
+
+namespace rive::pls
+{
+namespace
+{
+// Writes the section of 'p' between t0 and t1 into 'out'.
+void chop_cubic_between(const Vec2D p[4], float t0, float t1, Vec2D out[4])
+{
+    if (t0 <= 0)
+    {
+        if (t1 >= 1)
+        {
+            memcpy(out, p, sizeof(Vec2D) * 4);
+        }
+        else
+        {
+            Vec2D chops[7];
+            pathutils::ChopCubicAt(p, chops, t1);
+            memcpy(out, chops, sizeof(Vec2D) * 4);
+        }
+    }
+    else if (t1 >= 1)
+    {
+        Vec2D chops[7];
+        pathutils::ChopCubicAt(p, chops, t0);
+        memcpy(out, chops + 3, sizeof(Vec2D) * 4);
+    }
+    else
+    {
+        Vec2D chops[10];
+        pathutils::ChopCubicAt(p, chops, t0, t1);
+        memcpy(out, chops + 3, sizeof(Vec2D) * 4);
+    }
+}
+} // namespace
+
+bool PathDasher::dash(const RawPath& path,
+                      const Mat2D& matrix,
+                      const float intervals[],
+                      size_t intervalCount,
+                      float phase,
+                      RawPath* dst)
+{
+    dst->rewind();
+    if (intervalCount == 0)
+    {
+        return false;
+    }
+    float intervalSum = 0;
+    for (size_t i = 0; i < intervalCount; ++i)
+    {
+        if (!(intervals[i] >= 0)) // Also catches NaN.
+        {
+            return false;
+        }
+        intervalSum += intervals[i];
+    }
+    m_intervals = intervals;
+    m_sourceIntervalCount = intervalCount;
+    // An odd number of intervals repeats twice, so "on" and "off" swap on the second pass.
+    m_intervalCount = intervalCount & 1 ? intervalCount * 2 : intervalCount;
+    if (intervalCount & 1)
+    {
+        intervalSum *= 2;
+    }
+    if (!(intervalSum > 0) || !std::isfinite(intervalSum))
+    {
+        return false;
+    }
+
+    float pathLength = measure(path, matrix);
+    if (!(pathLength / intervalSum <= kMaxDashesPerPath))
+    {
+        return false;
+    }
+
+    // Find where the phase lands in the pattern.
+    phase = fmodf(phase, intervalSum);
+    if (phase < 0)
+    {
+        phase += intervalSum;
+    }
+    m_phaseIntervalIdx = 0;
+    for (size_t i = 0; i < m_intervalCount; ++i)
+    {
+        float interval = intervalAt(m_phaseIntervalIdx);
+        // Stop on a zero-length dash right at the phase, so it still gets drawn as a dot.
+        bool isZeroLengthDash = interval == 0 && (m_phaseIntervalIdx & 1) == 0;
+        if (phase < interval || (phase == 0 && isZeroLengthDash))
+        {
+            break;
+        }
+        phase -= interval;
+        m_phaseIntervalIdx = (m_phaseIntervalIdx + 1) % m_intervalCount;
+    }
+    m_phaseIntervalRemaining = std::max(intervalAt(m_phaseIntervalIdx) - phase, 0.f);
+
+    // Walk the pattern along the measurements we just took.
+    m_dst = dst;
+    const float* segmentLength = m_segmentLengths.data();
+    const uint32_t* cubicChordCount = m_cubicChordCounts.data();
+    const float* cubicArcLengths = m_cubicArcLengths.data();
+    Vec2D contourStart = {0, 0}, lastPt = {0, 0};
+    for (auto [verb, pts] : path)
+    {
+        switch (verb)
+        {
+            case PathVerb::move:
+                beginContour(pts[0]);
+                contourStart = lastPt = pts[0];
+                break;
+            case PathVerb::line:
+                addLine(pts[0], pts[1], *segmentLength++);
+                lastPt = pts[1];
+                break;
+            case PathVerb::quad:
+                RIVE_UNREACHABLE();
+            case PathVerb::cubic:
+                addCubic(pts, cubicArcLengths, *cubicChordCount);
+                cubicArcLengths += *cubicChordCount++ + 1;
+                ++segmentLength;
+                lastPt = pts[3];
+                break;
+            case PathVerb::close:
+                if (lastPt != contourStart)
+                {
+                    addLine(lastPt, contourStart, *segmentLength++);
+                }
+                lastPt = contourStart;
+                break;
+        }
+    }
+    assert(segmentLength == m_segmentLengths.data() + m_segmentLengths.size());
+    assert(cubicArcLengths == m_cubicArcLengths.data() + m_cubicArcLengths.size());
+    m_dst = nullptr;
+    m_intervals = nullptr;
+    return true;
+}
+
+float PathDasher::measure(const RawPath& path, const Mat2D& matrix)
+{
+    m_segmentLengths.clear();
+    m_cubicChordCounts.clear();
+    m_cubicArcLengths.clear();
+    wangs_formula::VectorXform vectorXform(matrix);
+    float totalLength = 0;
+    Vec2D contourStart = {0, 0}, lastPt = {0, 0};
+    for (auto [verb, pts] : path)
+    {
+        switch (verb)
+        {
+            case PathVerb::move:
+                contourStart = lastPt = pts[0];
+                break;
+            case PathVerb::line:
+            {
+                float length = (pts[1] - pts[0]).length();
+                m_segmentLengths.push_back(length);
+                totalLength += length;
+                lastPt = pts[1];
+                break;
+            }
+            case PathVerb::quad:
+                RIVE_UNREACHABLE();
+            case PathVerb::cubic:
+            {
+                // Measure the cubic as a polyline, fine enough to be within a fraction of a pixel
+                // on screen, and record the cumulative length at each vertex.
+                float n = ceilf(wangs_formula::cubic(pts, kParametricPrecision, vectorXform));
+                uint32_t chordCount = static_cast<uint32_t>(std::clamp(n, 1.f, kMaxChordsPerCubic));
+                EvalCubic evalCubic(pts);
+                float length = 0;
+                Vec2D lastChordPt = pts[0];
+                m_cubicArcLengths.push_back(0);
+                for (uint32_t i = 1; i < chordCount; ++i)
+                {
+                    float4 p = evalCubic.at(float4(static_cast<float>(i) / chordCount));
+                    Vec2D chordPt = {p.x, p.y};
+                    length += (chordPt - lastChordPt).length();
+                    m_cubicArcLengths.push_back(length);
+                    lastChordPt = chordPt;
+                }
+                length += (pts[3] - lastChordPt).length();
+                m_cubicArcLengths.push_back(length);
+                m_cubicChordCounts.push_back(chordCount);
+                m_segmentLengths.push_back(length);
+                totalLength += length;
+                lastPt = pts[3];
+                break;
+            }
+            case PathVerb::close:
+                if (lastPt != contourStart)
+                {
+                    float length = (contourStart - lastPt).length();
+                    m_segmentLengths.push_back(length);
+                    totalLength += length;
+                }
+                lastPt = contourStart;
+                break;
+        }
+    }
+    return totalLength;
+}
+
+void PathDasher::beginContour(Vec2D pt)
+{
+    m_intervalIdx = m_phaseIntervalIdx;
+    m_intervalRemaining = m_phaseIntervalRemaining;
+    m_needsMove = isOn();
+    if (m_needsMove && m_intervalRemaining == 0)
+    {
+        // The contour begins with a zero-length dash.
+        m_dst->move(pt);
+        m_needsMove = false;
+    }
+}
+
+template <typename PointAtFn, typename EmitPieceFn>
+void PathDasher::walkSegment(float segmentLength, PointAtFn&& pointAt, EmitPieceFn&& emitPiece)
+{
+    float pos = 0;
+    for (;;)
+    {
+        float take = std::min(m_intervalRemaining, segmentLength - pos);
+        if (take > 0 && isOn())
+        {
+            if (m_needsMove)
+            {
+                m_dst->move(pointAt(pos));
+                m_needsMove = false;
+            }
+            emitPiece(pos, pos + take);
+        }
+        pos += take;
+        m_intervalRemaining -= take;
+        if (m_intervalRemaining > 0)
+        {
+            return; // The segment ended in the middle of an interval.
+        }
+        // Advance to the next interval. The intervals sum to a positive number, so this loop
+        // always reaches an interval that outlasts the segment.
+        m_intervalIdx = (m_intervalIdx + 1) % m_intervalCount;
+        m_intervalRemaining = intervalAt(m_intervalIdx);
+        if (isOn())
+        {
+            if (m_intervalRemaining == 0)
+            {
+                // Zero-length dashes still get caps (e.g., dotted lines with round caps).
+                m_dst->move(pointAt(pos));
+                m_needsMove = false;
+            }
+            else
+            {
+                m_needsMove = true;
+            }
+        }
+    }
+}
+
+void PathDasher::addLine(Vec2D p0, Vec2D p1, float length)
+{
+    float inverseLength = length > 0 ? 1 / length : 0;
+    auto pointAt = [=](float s) { return p0 + (p1 - p0) * (s * inverseLength); };
+    walkSegment(length, pointAt, [&](float, float s1) { m_dst->line(pointAt(s1)); });
+}
+
+void PathDasher::addCubic(const Vec2D pts[4], const float* arcLengths, uint32_t chordCount)
+{
+    // Queries only ever move forward along the cubic, so find T values with a moving cursor.
+    uint32_t chordIdx = 0;
+    auto tAt = [&](float s) {
+        while (chordIdx + 1 < chordCount && arcLengths[chordIdx + 1] < s)
+        {
+            ++chordIdx;
+        }
+        float l0 = arcLengths[chordIdx], l1 = arcLengths[chordIdx + 1];
+        float f = l1 > l0 ? std::clamp((s - l0) / (l1 - l0), 0.f, 1.f) : 0;
+        return std::min((chordIdx + f) / chordCount, 1.f);
+    };
+    walkSegment(
+        arcLengths[chordCount],
+        [&](float s) { return pathutils::EvalCubicAt(pts, tAt(s)); },
+        [&](float s0, float s1) {
+            Vec2D piece[4];
+            chop_cubic_between(pts, tAt(s0), tAt(s1), piece);
+            m_dst->cubic(piece[1], piece[2], piece[3]);
+        });
+}
+} // namespace rive::pls
@@ -0,0 +1,81 @@
+/*
+ * Copyright 2024 Rive
+ */
+
+#pragma once
+
+#include "rive/math/mat2d.hpp"
+#include "rive/math/raw_path.hpp"
+#include <vector>
+
+namespace rive::pls
+{
+// Splits paths into dashes for stroking. Dashes are defined by an array of alternating "on" and
+// "off" arc lengths, starting 'phase' units into the pattern at the beginning of each contour.
+//
+// Every dash becomes its own contour in the output, with its own contour record and caps. Gaps
+// inside a single midpoint-fan contour would need shader support, so dashing happens here on the
+// CPU instead of inside the tessellator.
+//
+// The dasher keeps its arc length measurements in member buffers, so reusing one instance only
+// allocates when a path needs more room than any before it. The dashes themselves go into a
+// caller-provided RawPath.
+class PathDasher
+{
+public:
+    // Writes the dashed version of 'path' into 'dst'. Arc lengths are in local path space;
+    // 'matrix' only decides how finely curves get linearized when measuring them.
+    //
+    // Returns false (and leaves 'dst' empty) if the intervals don't describe a valid pattern, or
+    // would produce an unreasonable number of dashes, in which case the caller should stroke the
+    // path without dashing.
+    bool dash(const RawPath& path,
+              const Mat2D& matrix,
+              const float intervals[],
+              size_t intervalCount,
+              float phase,
+              RawPath* dst);
+
+private:
+    // Refuse to generate more dashes than this for a single path.
+    constexpr static float kMaxDashesPerPath = 100000;
+
+    // Upper bound on the number of chords we measure each cubic with.
+    constexpr static float kMaxChordsPerCubic = 256;
+
+    // Measures every line and cubic in the path (including implicit closing lines) and returns the
+    // total arc length.
+    float measure(const RawPath&, const Mat2D&);
+
+    // Resets the dash pattern to the phase for a new contour that begins at 'pt'.
+    void beginContour(Vec2D pt);
+
+    float intervalAt(size_t idx) const { return m_intervals[idx % m_sourceIntervalCount]; }
+    bool isOn() const { return (m_intervalIdx & 1) == 0; }
+
+    // Walks the dash pattern along a segment of length 'segmentLength', calling
+    // emitPiece(startLength, endLength) for each section that falls in an "on" interval, and
+    // pointAt(length) to find where each dash begins.
+    template <typename PointAtFn, typename EmitPieceFn>
+    void walkSegment(float segmentLength, PointAtFn&& pointAt, EmitPieceFn&& emitPiece);
+
+    void addLine(Vec2D p0, Vec2D p1, float length);
+    void addCubic(const Vec2D pts[4], const float* arcLengths, uint32_t chordCount);
+
+    // Results of measure(), consumed in path order.
+    std::vector<float> m_segmentLengths;
+    std::vector<uint32_t> m_cubicChordCounts;
+    std::vector<float> m_cubicArcLengths; // chordCount + 1 cumulative lengths per cubic.
+
+    // Dash pattern state.
+    const float* m_intervals = nullptr;
+    size_t m_sourceIntervalCount = 0;
+    size_t m_intervalCount = 0; // Doubled if m_sourceIntervalCount is odd.
+    size_t m_phaseIntervalIdx = 0;
+    float m_phaseIntervalRemaining = 0;
+    size_t m_intervalIdx = 0;
+    float m_intervalRemaining = 0;
+    bool m_needsMove = false; // Does the current "on" interval still need to begin a contour?
+    RawPath* m_dst = nullptr;
+};
+} // namespace rive::pls
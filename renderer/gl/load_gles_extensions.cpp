@@ -11,6 +11,7 @@ PFNGLDRAWELEMENTSINSTANCEDBASEINSTANCEEXTPROC glDrawElementsInstancedBaseInstanc
 PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCEEXTPROC
 glDrawElementsInstancedBaseVertexBaseInstanceEXT = nullptr;
 PFNGLFRAMEBUFFERFETCHBARRIERQCOMPROC glFramebufferFetchBarrierQCOM = nullptr;
+PFNGLGETQUERYOBJECTUI64VEXTPROC glGetQueryObjectui64vEXT = nullptr;
 
 void LoadGLESExtensions(const GLCapabilities& extensions)
 {
@@ -35,4 +36,10 @@ void LoadGLESExtensions(const GLCapabilities& extensions)
             "glFramebufferFetchBarrierQCOM");
         loadedExtensions.QCOM_shader_framebuffer_fetch_noncoherent = true;
     }
+    if (extensions.EXT_disjoint_timer_query && !loadedExtensions.EXT_disjoint_timer_query)
+    {
+        glGetQueryObjectui64vEXT =
+            (PFNGLGETQUERYOBJECTUI64VEXTPROC)eglGetProcAddress("glGetQueryObjectui64vEXT");
+        loadedExtensions.EXT_disjoint_timer_query = true;
+    }
 }
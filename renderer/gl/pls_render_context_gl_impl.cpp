@@ -33,6 +33,10 @@ const char atomic_draw[] = "";
 #define ENABLE_PLS_EXPERIMENTAL_ATOMICS
 #endif
 
+#ifdef RIVE_PLS_STATS
+#include <deque>
+#endif
+
 #ifdef RIVE_WEBGL
 #include <emscripten/emscripten.h>
 #include <emscripten/html5.h>
@@ -63,6 +67,200 @@ constexpr static int kPLSTexIdxOffset = 1;
 
 namespace rive::pls
 {
+#ifdef RIVE_PLS_STATS
+class PLSRenderContextGLImpl::GPUTimer
+{
+public:
+    enum class Stage
+    {
+        colorRamp,
+        simpleGradient,
+        tessellation,
+        drawList,
+        drawBatch,
+    };
+
+    // Wraps a block of GL commands in a query, unless the timer is null.
+    class ScopedQuery
+    {
+    public:
+        ScopedQuery(GPUTimer* timer, Stage stage) : m_timer(timer)
+        {
+            if (m_timer != nullptr)
+            {
+                m_timer->beginQuery(stage);
+            }
+        }
+
+        ~ScopedQuery()
+        {
+            if (m_timer != nullptr)
+            {
+                m_timer->endQuery();
+            }
+        }
+
+    private:
+        GPUTimer* const m_timer;
+    };
+
+    GPUTimer(const GLCapabilities& capabilities) :
+        // Desktop GL doesn't report disjoint events. GL_TIME_ELAPSED is core there.
+        m_checkDisjoint(capabilities.isGLES)
+    {
+        if (m_checkDisjoint)
+        {
+            // Reading GL_GPU_DISJOINT_EXT clears it. Start from a clean slate.
+            GLint disjoint;
+            glGetIntegerv(GL_GPU_DISJOINT_EXT, &disjoint);
+        }
+    }
+
+    ~GPUTimer()
+    {
+        for (const PendingFrame& frame : m_pendingFrames)
+        {
+            for (const Query& query : frame.queries)
+            {
+                glDeleteQueries(1, &query.id);
+            }
+        }
+        glDeleteQueries(static_cast<GLsizei>(m_queryPool.size()), m_queryPool.data());
+    }
+
+    // Starts a new frame of queries if this is the first flush of a frame.
+    void beginFlush(const FlushDescriptor& desc)
+    {
+        if (m_pendingFrames.empty() || m_pendingFrames.back().frameNumber != desc.frameNumber)
+        {
+            m_pendingFrames.emplace_back().frameNumber = desc.frameNumber;
+        }
+    }
+
+    // Only one GL_TIME_ELAPSED query can be active at a time, so queries can't be nested.
+    void beginQuery(Stage stage)
+    {
+        assert(!m_pendingFrames.empty());
+        GLuint id;
+        if (!m_queryPool.empty())
+        {
+            id = m_queryPool.back();
+            m_queryPool.pop_back();
+        }
+        else
+        {
+            glGenQueries(1, &id);
+        }
+        glBeginQuery(GL_TIME_ELAPSED_EXT, id);
+        m_pendingFrames.back().queries.push_back({stage, id});
+    }
+
+    void endQuery() { glEndQuery(GL_TIME_ELAPSED_EXT); }
+
+    // Reads back the results of every frame whose queries have all resolved, oldest first, without
+    // waiting on the GPU. Frames whose queries haven't resolved yet are left for a future call.
+    void pollFinishedFrames()
+    {
+        if (m_checkDisjoint)
+        {
+            GLint disjoint = 0;
+            glGetIntegerv(GL_GPU_DISJOINT_EXT, &disjoint);
+            if (disjoint)
+            {
+                // Something like a frequency change or a context switch happened on the GPU. Any
+                // query that was in flight may have garbage results.
+                for (PendingFrame& frame : m_pendingFrames)
+                {
+                    frame.disjoint = true;
+                }
+            }
+        }
+
+        while (!m_pendingFrames.empty() && isFrameAvailable(m_pendingFrames.front()))
+        {
+            const PendingFrame& frame = m_pendingFrames.front();
+            if (!frame.disjoint)
+            {
+                // Recycle the previous frame's drawBatchNanos allocation.
+                std::vector<uint64_t> drawBatchNanos = std::move(m_lastFrameStats.drawBatchNanos);
+                drawBatchNanos.clear();
+                m_lastFrameStats = PLSRenderContext::GPUFrameStats();
+                m_lastFrameStats.frameNumber = frame.frameNumber;
+                m_lastFrameStats.drawBatchNanos = std::move(drawBatchNanos);
+                for (const Query& query : frame.queries)
+                {
+                    GLuint64 nanos = 0;
+                    glGetQueryObjectui64vEXT(query.id, GL_QUERY_RESULT, &nanos);
+                    switch (query.stage)
+                    {
+                        case Stage::colorRamp:
+                            m_lastFrameStats.colorRampNanos += nanos;
+                            break;
+                        case Stage::simpleGradient:
+                            m_lastFrameStats.simpleGradientNanos += nanos;
+                            break;
+                        case Stage::tessellation:
+                            m_lastFrameStats.tessellationNanos += nanos;
+                            break;
+                        case Stage::drawList:
+                            m_lastFrameStats.drawListNanos += nanos;
+                            break;
+                        case Stage::drawBatch:
+                            m_lastFrameStats.drawListNanos += nanos;
+                            m_lastFrameStats.drawBatchNanos.push_back(nanos);
+                            break;
+                    }
+                }
+            }
+            for (const Query& query : frame.queries)
+            {
+                m_queryPool.push_back(query.id);
+            }
+            m_pendingFrames.pop_front();
+        }
+    }
+
+    // Frame numbers start at 1, so a zero means no frame has been read back yet.
+    const PLSRenderContext::GPUFrameStats* lastFrameStats() const
+    {
+        return m_lastFrameStats.frameNumber != 0 ? &m_lastFrameStats : nullptr;
+    }
+
+private:
+    struct Query
+    {
+        Stage stage;
+        GLuint id;
+    };
+
+    struct PendingFrame
+    {
+        uint64_t frameNumber = 0;
+        std::vector<Query> queries;
+        bool disjoint = false;
+    };
+
+    static bool isFrameAvailable(const PendingFrame& frame)
+    {
+        for (const Query& query : frame.queries)
+        {
+            GLuint available = GL_FALSE;
+            glGetQueryObjectuiv(query.id, GL_QUERY_RESULT_AVAILABLE, &available);
+            if (!available)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    const bool m_checkDisjoint;
+    std::deque<PendingFrame> m_pendingFrames;
+    std::vector<GLuint> m_queryPool;
+    PLSRenderContext::GPUFrameStats m_lastFrameStats;
+};
+#endif
+
 PLSRenderContextGLImpl::PLSRenderContextGLImpl(const char* rendererString,
                                                GLCapabilities capabilities,
                                                std::unique_ptr<PLSImpl> plsImpl) :
@@ -94,6 +292,28 @@ PLSRenderContextGLImpl::PLSRenderContextGLImpl(const char* rendererString,
         m_platformFeatures.avoidFlatVaryings = true;
     }
     m_platformFeatures.fragCoordBottomUp = true;
+    if (m_capabilities.EXT_texture_compression_s3tc)
+    {
+        m_platformFeatures.compressedTextureFormats |=
+            1 << static_cast<int>(CompressedTextureFormat::bc1RGBA) |
+            1 << static_cast<int>(CompressedTextureFormat::bc3RGBA);
+    }
+    if (m_capabilities.EXT_texture_compression_bptc)
+    {
+        m_platformFeatures.compressedTextureFormats |=
+            1 << static_cast<int>(CompressedTextureFormat::bc7RGBA);
+    }
+    if (m_capabilities.OES_compressed_ETC2_RGBA8_texture)
+    {
+        m_platformFeatures.compressedTextureFormats |=
+            1 << static_cast<int>(CompressedTextureFormat::etc2RGB8) |
+            1 << static_cast<int>(CompressedTextureFormat::etc2RGBA8);
+    }
+    if (m_capabilities.KHR_texture_compression_astc_ldr)
+    {
+        m_platformFeatures.compressedTextureFormats |=
+            1 << static_cast<int>(CompressedTextureFormat::astc4x4RGBA);
+    }
 
     std::vector<const char*> generalDefines;
     if (!m_capabilities.ARB_shader_storage_buffer_object)
@@ -220,6 +440,13 @@ PLSRenderContextGLImpl::PLSRenderContextGLImpl(const char* rendererString,
     {
         m_plsImpl->init(m_state);
     }
+
+#ifdef RIVE_PLS_STATS
+    if (m_capabilities.EXT_disjoint_timer_query)
+    {
+        m_gpuTimer = std::make_unique<GPUTimer>(m_capabilities);
+    }
+#endif
 }
 
 PLSRenderContextGLImpl::~PLSRenderContextGLImpl()
@@ -325,6 +552,58 @@ rcp<PLSTexture> PLSRenderContextGLImpl::makeImageTexture(uint32_t width,
     return adoptImageTexture(width, height, textureID);
 }
 
+static GLenum compressed_texture_internal_format(CompressedTextureFormat format)
+{
+    switch (format)
+    {
+        case CompressedTextureFormat::bc1RGBA:
+            return GL_COMPRESSED_RGBA_S3TC_DXT1_EXT;
+        case CompressedTextureFormat::bc3RGBA:
+            return GL_COMPRESSED_RGBA_S3TC_DXT5_EXT;
+        case CompressedTextureFormat::bc7RGBA:
+            return GL_COMPRESSED_RGBA_BPTC_UNORM_EXT;
+        case CompressedTextureFormat::etc2RGB8:
+            return GL_COMPRESSED_RGB8_ETC2;
+        case CompressedTextureFormat::etc2RGBA8:
+            return GL_COMPRESSED_RGBA8_ETC2_EAC;
+        case CompressedTextureFormat::astc4x4RGBA:
+            return GL_COMPRESSED_RGBA_ASTC_4x4_KHR;
+    }
+    RIVE_UNREACHABLE();
+}
+
+rcp<PLSTexture> PLSRenderContextGLImpl::makeCompressedImageTexture(
+    uint32_t width,
+    uint32_t height,
+    CompressedTextureFormat format,
+    const Span<const uint8_t> mipLevels[],
+    uint32_t mipLevelCount)
+{
+    assert(m_platformFeatures.supportsCompressedTextureFormat(format));
+    GLenum internalFormat = compressed_texture_internal_format(format);
+    GLuint textureID;
+    glGenTextures(1, &textureID);
+    glActiveTexture(GL_TEXTURE0 + kPLSTexIdxOffset + IMAGE_TEXTURE_IDX);
+    glBindTexture(GL_TEXTURE_2D, textureID);
+    glTexStorage2D(GL_TEXTURE_2D, mipLevelCount, internalFormat, width, height);
+    m_state->bindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+    for (uint32_t level = 0; level < mipLevelCount; ++level)
+    {
+        glCompressedTexSubImage2D(GL_TEXTURE_2D,
+                                  level,
+                                  0,
+                                  0,
+                                  std::max(width >> level, 1u),
+                                  std::max(height >> level, 1u),
+                                  internalFormat,
+                                  mipLevels[level].size(),
+                                  mipLevels[level].data());
+    }
+    glutils::SetTexture2DSamplingParams(mipLevelCount > 1 ? GL_LINEAR_MIPMAP_LINEAR : GL_LINEAR,
+                                        GL_LINEAR);
+    return adoptImageTexture(width, height, textureID);
+}
+
 rcp<PLSTexture> PLSRenderContextGLImpl::adoptImageTexture(uint32_t width,
                                                           uint32_t height,
                                                           GLuint textureID)
@@ -380,17 +659,25 @@ protected:
                                 0,
                                 mapSizeInBytes,
                                 GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT |
-                                    GL_MAP_UNSYNCHRONIZED_BIT);
+                                    GL_MAP_UNSYNCHRONIZED_BIT | GL_MAP_FLUSH_EXPLICIT_BIT);
 #endif
     }
 
-    void onUnmapAndSubmitBuffer(int bufferIdx, size_t mapSizeInBytes) override
+    void onUnmapAndSubmitBuffer(int bufferIdx, size_t updateSizeInBytes) override
     {
         m_state->bindBuffer(m_target, m_ids[bufferIdx]);
 #ifdef RIVE_WEBGL
         // WebGL doesn't support buffer mapping.
-        glBufferSubData(m_target, 0, mapSizeInBytes, shadowBuffer());
+        if (updateSizeInBytes != 0)
+        {
+            glBufferSubData(m_target, 0, updateSizeInBytes, shadowBuffer());
+        }
 #else
+        // The buffer was mapped with GL_MAP_FLUSH_EXPLICIT_BIT. Only flush the bytes we updated.
+        if (updateSizeInBytes != 0)
+        {
+            glFlushMappedBufferRange(m_target, 0, updateSizeInBytes);
+        }
         glUnmapBuffer(m_target);
 #endif
     }
@@ -501,7 +788,7 @@ public:
     ~TexelBufferRingWebGL() { glDeleteTextures(pls::kBufferRingSize, m_textures); }
 
     void* onMapBuffer(int bufferIdx, size_t mapSizeInBytes) override { return shadowBuffer(); }
-    void onUnmapAndSubmitBuffer(int bufferIdx, size_t mapSizeInBytes) override {}
+    void onUnmapAndSubmitBuffer(int bufferIdx, size_t updateSizeInBytes) override {}
 
     void bindToRenderContext(uint32_t bindingIdx,
                              size_t bindingSizeInBytes,
@@ -938,6 +1225,13 @@ void PLSRenderContextGLImpl::flush(const FlushDescriptor& desc)
 {
     auto renderTarget = static_cast<PLSRenderTargetGL*>(desc.renderTarget);
 
+#ifdef RIVE_PLS_STATS
+    if (m_gpuTimer != nullptr)
+    {
+        m_gpuTimer->beginFlush(desc);
+    }
+#endif
+
     m_state->setWriteMasks(true, true, 0xff);
     m_state->disableBlending();
 
@@ -982,6 +1276,8 @@ void PLSRenderContextGLImpl::flush(const FlushDescriptor& desc)
     // Render the complex color ramps into the gradient texture.
     if (desc.complexGradSpanCount > 0)
     {
+        RIVE_PLS_STATS_CODE(
+            GPUTimer::ScopedQuery timerQuery(m_gpuTimer.get(), GPUTimer::Stage::colorRamp);)
         m_state->bindBuffer(GL_ARRAY_BUFFER, gl_buffer_id(gradSpanBufferRing()));
         m_state->bindVAO(m_colorRampVAO);
         m_state->setCullFace(GL_BACK);
@@ -1002,6 +1298,8 @@ void PLSRenderContextGLImpl::flush(const FlushDescriptor& desc)
     // Copy the simple color ramps to the gradient texture.
     if (desc.simpleGradTexelsHeight > 0)
     {
+        RIVE_PLS_STATS_CODE(
+            GPUTimer::ScopedQuery timerQuery(m_gpuTimer.get(), GPUTimer::Stage::simpleGradient);)
         m_state->bindBuffer(GL_PIXEL_UNPACK_BUFFER, gl_buffer_id(simpleColorRampsBufferRing()));
         glActiveTexture(GL_TEXTURE0 + kPLSTexIdxOffset + GRAD_TEXTURE_IDX);
 #ifdef RIVE_WEBGL
@@ -1033,6 +1331,8 @@ void PLSRenderContextGLImpl::flush(const FlushDescriptor& desc)
     // Tessellate all curves into vertices in the tessellation texture.
     if (desc.tessVertexSpanCount > 0)
     {
+        RIVE_PLS_STATS_CODE(
+            GPUTimer::ScopedQuery timerQuery(m_gpuTimer.get(), GPUTimer::Stage::tessellation);)
         m_state->bindBuffer(GL_ARRAY_BUFFER, gl_buffer_id(tessSpanBufferRing()));
         m_state->bindVAO(m_tessellateVAO);
         m_state->setCullFace(GL_BACK);
@@ -1105,6 +1405,17 @@ void PLSRenderContextGLImpl::flush(const FlushDescriptor& desc)
     }
 #endif
 
+#ifdef RIVE_PLS_STATS
+    // GL_TIME_ELAPSED queries can't be nested, so when DrawBatches are timed individually, the draw
+    // list as a whole isn't.
+    GPUTimer* drawListTimer = desc.gpuDrawBatchTimings ? nullptr : m_gpuTimer.get();
+    GPUTimer* drawBatchTimer = desc.gpuDrawBatchTimings ? m_gpuTimer.get() : nullptr;
+    if (drawListTimer != nullptr)
+    {
+        drawListTimer->beginQuery(GPUTimer::Stage::drawList);
+    }
+#endif
+
     auto msaaResolveAction = PLSRenderTargetGL::MSAAResolveAction::automatic;
     if (desc.interlockMode != pls::InterlockMode::depthStencil)
     {
@@ -1178,6 +1489,9 @@ void PLSRenderContextGLImpl::flush(const FlushDescriptor& desc)
         }
         m_state->bindProgram(drawProgram.id());
 
+        RIVE_PLS_STATS_CODE(
+            GPUTimer::ScopedQuery timerQuery(drawBatchTimer, GPUTimer::Stage::drawBatch);)
+
         if (auto imageTextureGL = static_cast<const PLSTextureGLImpl*>(batch.imageTexture))
         {
             glActiveTexture(GL_TEXTURE0 + kPLSTexIdxOffset + IMAGE_TEXTURE_IDX);
@@ -1376,11 +1690,50 @@ void PLSRenderContextGLImpl::flush(const FlushDescriptor& desc)
             }
             case pls::DrawType::interiorTriangulation:
             {
-                assert(desc.interlockMode != pls::InterlockMode::depthStencil); // TODO!
-                m_plsImpl->ensureRasterOrderingEnabled(this, false);
+                LITE_RTTI_CAST_OR_BREAK(indexBuffer,
+                                        const PLSRenderBufferGLImpl*,
+                                        batch.indexBuffer);
                 m_state->bindVAO(m_trianglesVAO);
+                m_state->bindBuffer(GL_ELEMENT_ARRAY_BUFFER, indexBuffer->submittedBufferID());
+                if (desc.interlockMode != pls::InterlockMode::depthStencil)
+                {
+                    m_plsImpl->ensureRasterOrderingEnabled(this, false);
+                }
+                else
+                {
+                    // MSAA triangulations cover exactly the path's filled area, without overlap,
+                    // so they can skip the "stencil" step and render directly.
+                    bool hasActiveClip = ((batch.drawContents & pls::DrawContents::activeClip));
+                    bool isClipUpdate = ((batch.drawContents & pls::DrawContents::clipUpdate));
+                    bool isNestedClipUpdate = (batch.drawContents & pls::kNestedClipUpdateMask) ==
+                                              pls::kNestedClipUpdateMask;
+                    bool isEvenOddFill = (batch.drawContents & pls::DrawContents::evenOddFill);
+                    if (isNestedClipUpdate)
+                    {
+                        // Mark the nested clip inside the existing clip, and leave it in the
+                        // stencil buffer for DrawType::stencilClipReset to intersect.
+                        glStencilFunc(GL_LEQUAL, 0x80, 0xff);
+                        glStencilOp(GL_KEEP, GL_KEEP, GL_INCR_WRAP);
+                        m_state->setWriteMasks(false, false, isEvenOddFill ? 0x1 : 0x7f);
+                    }
+                    else if (isClipUpdate)
+                    {
+                        glStencilFunc(GL_ALWAYS, 0x80, 0xff);
+                        glStencilOp(GL_KEEP, GL_KEEP, GL_REPLACE);
+                        m_state->setWriteMasks(false, false, 0xff);
+                    }
+                    else
+                    {
+                        glStencilFunc(hasActiveClip ? GL_EQUAL : GL_ALWAYS, 0x80, 0xff);
+                        glStencilOp(GL_KEEP, GL_KEEP, GL_KEEP);
+                        m_state->setWriteMasks(true, true, 0xff);
+                    }
+                }
                 m_state->setCullFace(GL_BACK);
-                glDrawArrays(GL_TRIANGLES, batch.baseElement, batch.elementCount);
+                glDrawElements(GL_TRIANGLES,
+                               batch.elementCount,
+                               GL_UNSIGNED_INT,
+                               reinterpret_cast<const void*>(batch.baseElement * sizeof(uint32_t)));
                 break;
             }
             case pls::DrawType::imageRect:
@@ -1412,10 +1765,12 @@ void PLSRenderContextGLImpl::flush(const FlushDescriptor& desc)
                                         const PLSRenderBufferGLImpl*,
                                         batch.indexBuffer);
                 m_state->bindVAO(m_imageMeshVAO);
+                const void* vertexDataOffset =
+                    reinterpret_cast<const void*>(batch.vertexDataOffsetInBytes);
                 m_state->bindBuffer(GL_ARRAY_BUFFER, vertexBuffer->submittedBufferID());
-                glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 0, nullptr);
+                glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 0, vertexDataOffset);
                 m_state->bindBuffer(GL_ARRAY_BUFFER, uvBuffer->submittedBufferID());
-                glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 0, nullptr);
+                glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 0, vertexDataOffset);
                 m_state->bindBuffer(GL_ELEMENT_ARRAY_BUFFER, indexBuffer->submittedBufferID());
                 glBindBufferRange(GL_UNIFORM_BUFFER,
                                   IMAGE_DRAW_UNIFORM_BUFFER_IDX,
@@ -1495,13 +1850,34 @@ void PLSRenderContextGLImpl::flush(const FlushDescriptor& desc)
         }
     }
 
+#ifdef RIVE_PLS_STATS
+    if (drawListTimer != nullptr)
+    {
+        drawListTimer->endQuery();
+    }
+#endif
+
 #ifdef RIVE_DESKTOP_GL
     if (m_capabilities.ANGLE_polygon_mode && desc.wireframe)
     {
         glPolygonModeANGLE(GL_FRONT_AND_BACK, GL_FILL_ANGLE);
     }
 #endif
+
+#ifdef RIVE_PLS_STATS
+    if (m_gpuTimer != nullptr && desc.isFinalFlushOfFrame)
+    {
+        m_gpuTimer->pollFinishedFrames();
+    }
+#endif
+}
+
+#ifdef RIVE_PLS_STATS
+const PLSRenderContext::GPUFrameStats* PLSRenderContextGLImpl::lastGPUFrameStats() const
+{
+    return m_gpuTimer != nullptr ? m_gpuTimer->lastFrameStats() : nullptr;
 }
+#endif
 
 void PLSRenderContextGLImpl::blitTextureToFramebufferAsDraw(GLuint textureID,
                                                             const IAABB& bounds,
@@ -1619,6 +1995,10 @@ std::unique_ptr<PLSRenderContext> PLSRenderContextGLImpl::MakeContext(
         {
             capabilities.ARB_shader_storage_buffer_object = true;
         }
+#ifndef RIVE_WEBGL
+        // ETC2 is core in GLES 3.0. (WebGL 2 requires WEBGL_compressed_texture_etc.)
+        capabilities.OES_compressed_ETC2_RGBA8_texture = true;
+#endif
     }
     else
     {
@@ -1683,6 +2063,10 @@ std::unique_ptr<PLSRenderContext> PLSRenderContextGLImpl::MakeContext(
         {
             capabilities.KHR_blend_equation_advanced_coherent = true;
         }
+        else if (strcmp(ext, "GL_KHR_texture_compression_astc_ldr") == 0)
+        {
+            capabilities.KHR_texture_compression_astc_ldr = true;
+        }
         else if (strcmp(ext, "GL_EXT_base_instance") == 0)
         {
             capabilities.EXT_base_instance = true;
@@ -1695,6 +2079,10 @@ std::unique_ptr<PLSRenderContext> PLSRenderContextGLImpl::MakeContext(
         {
             capabilities.EXT_clip_cull_distance = true;
         }
+        else if (strcmp(ext, "GL_EXT_disjoint_timer_query") == 0)
+        {
+            capabilities.EXT_disjoint_timer_query = true;
+        }
         else if (strcmp(ext, "GL_INTEL_fragment_shader_ordering") == 0)
         {
             capabilities.INTEL_fragment_shader_ordering = true;
@@ -1707,6 +2095,15 @@ std::unique_ptr<PLSRenderContext> PLSRenderContextGLImpl::MakeContext(
         {
             capabilities.EXT_shader_pixel_local_storage = true;
         }
+        else if (strcmp(ext, "GL_EXT_texture_compression_bptc") == 0 ||
+                 strcmp(ext, "GL_ARB_texture_compression_bptc") == 0)
+        {
+            capabilities.EXT_texture_compression_bptc = true;
+        }
+        else if (strcmp(ext, "GL_EXT_texture_compression_s3tc") == 0)
+        {
+            capabilities.EXT_texture_compression_s3tc = true;
+        }
         else if (strcmp(ext, "GL_QCOM_shader_framebuffer_fetch_noncoherent") == 0)
         {
             capabilities.QCOM_shader_framebuffer_fetch_noncoherent = true;
@@ -1727,6 +2124,26 @@ std::unique_ptr<PLSRenderContext> PLSRenderContextGLImpl::MakeContext(
     {
         capabilities.EXT_clip_cull_distance = true;
     }
+    if (emscripten_webgl_enable_extension(emscripten_webgl_get_current_context(),
+                                          "WEBGL_compressed_texture_astc"))
+    {
+        capabilities.KHR_texture_compression_astc_ldr = true;
+    }
+    if (emscripten_webgl_enable_extension(emscripten_webgl_get_current_context(),
+                                          "EXT_texture_compression_bptc"))
+    {
+        capabilities.EXT_texture_compression_bptc = true;
+    }
+    if (emscripten_webgl_enable_extension(emscripten_webgl_get_current_context(),
+                                          "WEBGL_compressed_texture_s3tc"))
+    {
+        capabilities.EXT_texture_compression_s3tc = true;
+    }
+    if (emscripten_webgl_enable_extension(emscripten_webgl_get_current_context(),
+                                          "WEBGL_compressed_texture_etc"))
+    {
+        capabilities.OES_compressed_ETC2_RGBA8_texture = true;
+    }
 #endif // RIVE_WEBGL
 
 #ifdef RIVE_DESKTOP_GL
@@ -1747,6 +2164,10 @@ std::unique_ptr<PLSRenderContext> PLSRenderContextGLImpl::MakeContext(
     {
         capabilities.EXT_base_instance = true;
     }
+    if (GLAD_GL_EXT_disjoint_timer_query)
+    {
+        capabilities.EXT_disjoint_timer_query = true;
+    }
 #endif
 
     // We need four storage buffers in the vertex shader. Disable the extension if this isn't
@@ -16,48 +16,64 @@ namespace rive
 {
 // Triangulates the inner polygon(s) of a path (i.e., the triangle fan for a Redbook rendering
 // method). When combined with the outer curves and grout triangles, these produce a complete path.
-// If a groutCollector is not provided, pathToPolys fails upon self intersection.
+//
+// If the path has already been flattened (i.e., there are no outer curves), grout triangles can be
+// ignored, in which case the triangulation alone covers the path's filled area.
 class GrInnerFanTriangulator : private GrTriangulator
 {
 public:
     using GrTriangulator::GroutTriangleList;
 
+    enum class GroutTriangles : bool
+    {
+        collect,
+        ignore,
+    };
+
     GrInnerFanTriangulator(const RawPath& path,
                            const Mat2D& viewMatrix,
                            Comparator::Direction direction,
                            FillRule fillRule,
-                           TrivialBlockAllocator* alloc) :
+                           TrivialBlockAllocator* alloc,
+                           GroutTriangles groutTriangles) :
         GrTriangulator(direction, fillRule, alloc),
         m_shouldReverseTriangles(viewMatrix[0] * viewMatrix[3] - viewMatrix[2] * viewMatrix[1] < 0)
     {
-        fPreserveCollinearVertices = true;
-        fCollectGroutTriangles = true;
+        // Outer curves need to line up exactly with the inner polygon's vertices.
+        fPreserveCollinearVertices = groutTriangles == GroutTriangles::collect;
+        fCollectGroutTriangles = groutTriangles == GroutTriangles::collect;
         bool isLinear;
         auto [polys, success] = GrTriangulator::pathToPolys(path, 0, AABB{}, &isLinear);
         if (success)
         {
             m_polys = polys;
             m_maxVertexCount = countMaxTriangleVertices(m_polys);
+            m_maxIndexCount = countMaxTriangleIndices(m_polys);
         }
     }
 
     FillRule fillRule() const { return fFillRule; }
 
     uint64_t maxVertexCount() const { return m_maxVertexCount; }
+    uint64_t maxIndexCount() const { return m_maxIndexCount; }
 
-    size_t polysToTriangles(pls::WriteOnlyMappedMemory<pls::TriangleVertex>* bufferRing,
+    // Writes the triangulation as an indexed triangle list and returns the number of indices.
+    size_t polysToTriangles(pls::WriteOnlyMappedMemory<pls::TriangleVertex>* vertexBufferRing,
+                            pls::WriteOnlyMappedMemory<uint32_t>* indexBufferRing,
                             uint16_t pathID) const
 
     {
-        if (m_polys == nullptr || m_maxVertexCount == 0)
+        if (m_polys == nullptr || m_maxIndexCount == 0)
         {
             return 0;
         }
         return GrTriangulator::polysToTriangles(m_polys,
                                                 m_maxVertexCount,
+                                                m_maxIndexCount,
                                                 pathID,
                                                 m_shouldReverseTriangles,
-                                                bufferRing);
+                                                vertexBufferRing,
+                                                indexBufferRing);
     }
 
     const GroutTriangleList& groutList() const { return fGroutList; }
@@ -68,6 +84,7 @@ private:
     bool m_shouldReverseTriangles;
     Poly* m_polys = nullptr;
     uint64_t m_maxVertexCount = 0;
+    uint64_t m_maxIndexCount = 0;
 };
 } // namespace rive
 
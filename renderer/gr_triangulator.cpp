@@ -11,6 +11,7 @@
 
 #include "gr_triangulator.hpp"
 #include "path_utils.hpp"
+#include "rive/math/math_types.hpp"
 
 #include <algorithm>
 
@@ -114,34 +115,34 @@ bool GrTriangulator::Comparator::sweep_lt(const Vec2D& a, const Vec2D& b) const
 static inline void emit_vertex(Vertex* v,
                                int winding,
                                uint16_t pathID,
-                               pls::WriteOnlyMappedMemory<pls::TriangleVertex>* mappedMemory)
+                               pls::WriteOnlyMappedMemory<pls::TriangleVertex>* vertexMemory)
 {
     // GrTriangulator and pls unfortunately have opposite winding senses.
     int16_t plsWeight = -winding;
-    mappedMemory->emplace_back(v->fPoint, plsWeight, pathID);
+    // Remember where the vertex landed so the triangles that share it can index it.
+    v->fIndex = static_cast<uint32_t>(vertexMemory->elementsWritten());
+    vertexMemory->emplace_back(v->fPoint, plsWeight, pathID);
 }
 
 static void emit_triangle(Vertex* v0,
                           Vertex* v1,
                           Vertex* v2,
-                          int winding,
-                          uint16_t pathID,
-                          pls::WriteOnlyMappedMemory<pls::TriangleVertex>* mappedMemory)
+                          pls::WriteOnlyMappedMemory<uint32_t>* indexMemory)
 {
     TESS_LOG("emit_triangle %g (%g, %g) %d\n", v0->fID, v0->fPoint.x, v0->fPoint.y, v0->fAlpha);
     TESS_LOG("              %g (%g, %g) %d\n", v1->fID, v1->fPoint.x, v1->fPoint.y, v1->fAlpha);
     TESS_LOG("              %g (%g, %g) %d\n", v2->fID, v2->fPoint.x, v2->fPoint.y, v2->fAlpha);
 #if TESSELLATOR_WIREFRAME
-    emit_vertex(v0, winding, pathID, mappedMemory);
-    emit_vertex(v1, winding, pathID, mappedMemory);
-    emit_vertex(v1, winding, pathID, mappedMemory);
-    emit_vertex(v2, winding, pathID, mappedMemory);
-    emit_vertex(v2, winding, pathID, mappedMemory);
-    emit_vertex(v0, winding, pathID, mappedMemory);
+    indexMemory->emplace_back(v0->fIndex);
+    indexMemory->emplace_back(v1->fIndex);
+    indexMemory->emplace_back(v1->fIndex);
+    indexMemory->emplace_back(v2->fIndex);
+    indexMemory->emplace_back(v2->fIndex);
+    indexMemory->emplace_back(v0->fIndex);
 #else
-    emit_vertex(v0, winding, pathID, mappedMemory);
-    emit_vertex(v1, winding, pathID, mappedMemory);
-    emit_vertex(v2, winding, pathID, mappedMemory);
+    indexMemory->emplace_back(v0->fIndex);
+    indexMemory->emplace_back(v1->fIndex);
+    indexMemory->emplace_back(v2->fIndex);
 #endif
 }
 
@@ -407,11 +408,11 @@ void GrTriangulator::MonotonePoly::addEdge(Edge* edge)
     }
 }
 
-void GrTriangulator::emitMonotonePoly(
-    const MonotonePoly* monotonePoly,
-    uint16_t pathID,
-    bool reverseTriangles,
-    pls::WriteOnlyMappedMemory<pls::TriangleVertex>* mappedMemory) const
+void GrTriangulator::emitMonotonePoly(const MonotonePoly* monotonePoly,
+                                      uint16_t pathID,
+                                      bool reverseTriangles,
+                                      pls::WriteOnlyMappedMemory<pls::TriangleVertex>* vertexMemory,
+                                      pls::WriteOnlyMappedMemory<uint32_t>* indexMemory) const
 {
     assert(monotonePoly->fWinding != 0);
     Edge* e = monotonePoly->fFirstEdge;
@@ -432,6 +433,16 @@ void GrTriangulator::emitMonotonePoly(
         }
         count++;
     }
+    if (count < 3)
+    {
+        return;
+    }
+    // Every triangle in a monotone polygon has the same winding, so they can all share a single
+    // copy of each vertex.
+    for (Vertex* v = vertices.fHead; v != nullptr; v = v->fNext)
+    {
+        emit_vertex(v, monotonePoly->fWinding, pathID, vertexMemory);
+    }
     Vertex* first = vertices.fHead;
     Vertex* v = first->fNext;
     while (v != vertices.fTail)
@@ -442,13 +453,7 @@ void GrTriangulator::emitMonotonePoly(
         Vertex* next = v->fNext;
         if (count == 3)
         {
-            return emitTriangle(prev,
-                                curr,
-                                next,
-                                monotonePoly->fWinding,
-                                pathID,
-                                reverseTriangles,
-                                mappedMemory);
+            return emitTriangle(prev, curr, next, reverseTriangles, indexMemory);
         }
         double ax = static_cast<double>(curr->fPoint.x) - prev->fPoint.x;
         double ay = static_cast<double>(curr->fPoint.y) - prev->fPoint.y;
@@ -456,13 +461,7 @@ void GrTriangulator::emitMonotonePoly(
         double by = static_cast<double>(next->fPoint.y) - curr->fPoint.y;
         if (ax * by - ay * bx >= 0.0)
         {
-            emitTriangle(prev,
-                         curr,
-                         next,
-                         monotonePoly->fWinding,
-                         pathID,
-                         reverseTriangles,
-                         mappedMemory);
+            emitTriangle(prev, curr, next, reverseTriangles, indexMemory);
             v->fPrev->fNext = v->fNext;
             v->fNext->fPrev = v->fPrev;
             count--;
@@ -482,20 +481,17 @@ void GrTriangulator::emitMonotonePoly(
     }
 }
 
-void GrTriangulator::emitTriangle(
-    Vertex* prev,
-    Vertex* curr,
-    Vertex* next,
-    int winding,
-    uint16_t pathID,
-    bool reverseTriangles,
-    pls::WriteOnlyMappedMemory<pls::TriangleVertex>* mappedMemory) const
+void GrTriangulator::emitTriangle(Vertex* prev,
+                                  Vertex* curr,
+                                  Vertex* next,
+                                  bool reverseTriangles,
+                                  pls::WriteOnlyMappedMemory<uint32_t>* indexMemory) const
 {
     if (reverseTriangles)
     {
         std::swap(prev, next);
     }
-    return emit_triangle(prev, curr, next, winding, pathID, mappedMemory);
+    return emit_triangle(prev, curr, next, indexMemory);
 }
 
 GrTriangulator::Poly::Poly(Vertex* v, int winding) :
@@ -579,7 +575,8 @@ Poly* GrTriangulator::Poly::addEdge(Edge* e, Side side, GrTriangulator* tri)
 void GrTriangulator::emitPoly(const Poly* poly,
                               uint16_t pathID,
                               bool reverseTriangles,
-                              pls::WriteOnlyMappedMemory<pls::TriangleVertex>* mappedMemory) const
+                              pls::WriteOnlyMappedMemory<pls::TriangleVertex>* vertexMemory,
+                              pls::WriteOnlyMappedMemory<uint32_t>* indexMemory) const
 {
     if (poly->fCount < 3)
     {
@@ -588,7 +585,7 @@ void GrTriangulator::emitPoly(const Poly* poly,
     TESS_LOG("emit() %d, size %d\n", poly->fID, poly->fCount);
     for (MonotonePoly* m = poly->fHead; m != nullptr; m = m->fNext)
     {
-        emitMonotonePoly(m, pathID, reverseTriangles, mappedMemory);
+        emitMonotonePoly(m, pathID, reverseTriangles, vertexMemory, indexMemory);
     }
 }
 
@@ -1660,40 +1657,6 @@ void GrTriangulator::SortedMerge(VertexList* front,
 #endif
 }
 
-// Stage 3: sort the vertices by increasing sweep direction.
-
-template <CompareFunc sweep_lt> static void merge_sort(VertexList* vertices)
-{
-    Vertex* slow = vertices->fHead;
-    if (!slow)
-    {
-        return;
-    }
-    Vertex* fast = slow->fNext;
-    if (!fast)
-    {
-        return;
-    }
-    do
-    {
-        fast = fast->fNext;
-        if (fast)
-        {
-            fast = fast->fNext;
-            slow = slow->fNext;
-        }
-    } while (fast);
-    VertexList front(vertices->fHead, slow);
-    VertexList back(slow->fNext, vertices->fTail);
-    front.fTail->fNext = back.fHead->fPrev = nullptr;
-
-    merge_sort<sweep_lt>(&front);
-    merge_sort<sweep_lt>(&back);
-
-    vertices->fHead = vertices->fTail = nullptr;
-    sorted_merge<sweep_lt>(&front, &back, vertices);
-}
-
 #if TRIANGULATOR_LOGGING
 void VertexList::dump() const
 {
@@ -2036,22 +1999,124 @@ void GrTriangulator::contoursToMesh(VertexList* contours,
     this->buildEdges(contours, contourCnt, mesh, c);
 }
 
-void GrTriangulator::SortMesh(VertexList* vertices, const Comparator& c)
+// Stage 3: sort the vertices by increasing sweep direction.
+
+// Below this many vertices, a comparison sort beats the radix sort's histogram passes.
+constexpr static size_t kMinRadixSortVertexCount = 256;
+
+// Maps a float to an unsigned integer with the same sort order. (-0 and +0 are expected to have
+// been canonicalized already.)
+static uint32_t float_sort_key(float f)
+{
+    uint32_t bits = math::bit_cast<uint32_t>(f);
+    return bits & 0x80000000 ? ~bits : bits | 0x80000000;
+}
+
+struct VertexSortEntry
+{
+    uint64_t key;
+    Vertex* vertex;
+};
+
+// Stable LSD radix sort on VertexSortEntry::key. 'scratch' must be the same size as 'entries'.
+// Returns whichever of the two arrays the sorted result ended up in.
+static const VertexSortEntry* radix_sort(VertexSortEntry* entries,
+                                         VertexSortEntry* scratch,
+                                         size_t count)
+{
+    constexpr static int kDigitBits = 8;
+    constexpr static uint32_t kDigitMask = (1 << kDigitBits) - 1;
+    for (int shift = 0; shift < 64; shift += kDigitBits)
+    {
+        uint32_t histogram[kDigitMask + 1] = {};
+        for (size_t i = 0; i < count; ++i)
+        {
+            ++histogram[(entries[i].key >> shift) & kDigitMask];
+        }
+        if (histogram[(entries[0].key >> shift) & kDigitMask] == count)
+        {
+            continue; // Every key has the same digit. (Common in the high bits of nearby floats.)
+        }
+        uint32_t offset = 0;
+        for (uint32_t& bucket : histogram)
+        {
+            uint32_t bucketCount = bucket;
+            bucket = offset;
+            offset += bucketCount;
+        }
+        for (size_t i = 0; i < count; ++i)
+        {
+            scratch[histogram[(entries[i].key >> shift) & kDigitMask]++] = entries[i];
+        }
+        std::swap(entries, scratch);
+    }
+    return entries;
+}
+
+void GrTriangulator::sortMesh(VertexList* vertices, const Comparator& c) const
 {
     if (!vertices || !vertices->fHead)
     {
         return;
     }
 
-    // Sort vertices in Y (secondarily in X).
-    if (c.fDirection == Comparator::Direction::kHorizontal)
+    // Sort vertices in Y (secondarily in X). Chasing pointers through a linked-list merge sort is
+    // slow for large meshes, so gather the vertices into an array, radix sort them by a key that
+    // matches the sweep comparator, and then relink them in order.
+    size_t count = 0;
+    for (Vertex* v = vertices->fHead; v != nullptr; v = v->fNext)
+    {
+        ++count;
+    }
+    auto* entries = static_cast<VertexSortEntry*>(
+        fAlloc->alloc<alignof(VertexSortEntry)>(count * sizeof(VertexSortEntry)));
+    size_t i = 0;
+    for (Vertex* v = vertices->fHead; v != nullptr; v = v->fNext)
+    {
+        // Adding zero turns -0 into +0, which the comparator treats as equal.
+        uint32_t xKey = float_sort_key(v->fPoint.x + 0.f);
+        uint32_t yKey = float_sort_key(v->fPoint.y + 0.f);
+        uint64_t key;
+        if (c.fDirection == Comparator::Direction::kHorizontal)
+        {
+            key = static_cast<uint64_t>(xKey) << 32 | ~yKey; // Increasing X, then decreasing Y.
+        }
+        else
+        {
+            key = static_cast<uint64_t>(yKey) << 32 | xKey; // Increasing Y, then increasing X.
+        }
+        entries[i++] = {key, v};
+    }
+    const VertexSortEntry* sorted = entries;
+    if (count < kMinRadixSortVertexCount)
     {
-        merge_sort<sweep_lt_horiz>(vertices);
+        std::stable_sort(entries,
+                         entries + count,
+                         [](const VertexSortEntry& a, const VertexSortEntry& b) {
+                             return a.key < b.key;
+                         });
     }
     else
     {
-        merge_sort<sweep_lt_vert>(vertices);
+        auto* scratch = static_cast<VertexSortEntry*>(
+            fAlloc->alloc<alignof(VertexSortEntry)>(count * sizeof(VertexSortEntry)));
+        sorted = radix_sort(entries, scratch, count);
+    }
+
+    Vertex* prev = nullptr;
+    for (size_t i = 0; i < count; ++i)
+    {
+        Vertex* v = sorted[i].vertex;
+        v->fPrev = prev;
+        if (prev != nullptr)
+        {
+            prev->fNext = v;
+        }
+        prev = v;
     }
+    prev->fNext = nullptr;
+    vertices->fHead = sorted[0].vertex;
+    vertices->fTail = prev;
 #if TRIANGULATOR_LOGGING
     for (Vertex* v = vertices->fHead; v != nullptr; v = v->fNext)
     {
@@ -2068,7 +2133,7 @@ std::tuple<Poly*, bool> GrTriangulator::contoursToPolys(VertexList* contours, in
     this->contoursToMesh(contours, contourCnt, &mesh, c);
     TESS_LOG("\ninitial mesh:\n");
     DUMP_MESH(mesh);
-    SortMesh(&mesh, c);
+    this->sortMesh(&mesh, c);
     TESS_LOG("\nsorted mesh:\n");
     DUMP_MESH(mesh);
     this->mergeCoincidentVertices(&mesh, c);
@@ -2084,19 +2149,20 @@ std::tuple<Poly*, bool> GrTriangulator::contoursToPolys(VertexList* contours, in
     return this->tessellate(mesh, c);
 }
 
-// Stage 6: Triangulate the monotone polygons into a vertex buffer.
+// Stage 6: Triangulate the monotone polygons into vertex and index buffers.
 void GrTriangulator::polysToTriangles(
     const Poly* polys,
     FillRule overrideFillType,
     uint16_t pathID,
     bool reverseTriangles,
-    pls::WriteOnlyMappedMemory<pls::TriangleVertex>* mappedMemory) const
+    pls::WriteOnlyMappedMemory<pls::TriangleVertex>* vertexMemory,
+    pls::WriteOnlyMappedMemory<uint32_t>* indexMemory) const
 {
     for (const Poly* poly = polys; poly; poly = poly->fNext)
     {
         if (apply_fill_type(overrideFillType, poly))
         {
-            emitPoly(poly, pathID, reverseTriangles, mappedMemory);
+            emitPoly(poly, pathID, reverseTriangles, vertexMemory, indexMemory);
         }
     }
 }
@@ -2173,9 +2239,29 @@ int64_t GrTriangulator::CountPoints(const Poly* polys, FillRule overrideFillType
     return count;
 }
 
-// Stage 6: Triangulate the monotone polygons into a vertex buffer.
+// Stage 6: Triangulate the monotone polygons into vertex and index buffers.
 
 size_t GrTriangulator::countMaxTriangleVertices(const Poly* polys) const
+{
+    // Each monotone polygon writes its own copy of its vertices. Poly::addEdge() counts both
+    // vertices of the first monotone polygon's first edge, and one vertex for every edge after
+    // that, so each additional monotone polygon contributes 2 vertices that fCount doesn't see.
+    size_t count = 0;
+    for (const Poly* poly = polys; poly; poly = poly->fNext)
+    {
+        if (apply_fill_type(fFillRule, poly) && poly->fCount >= 3)
+        {
+            count += poly->fCount - 2;
+            for (const MonotonePoly* m = poly->fHead; m != nullptr; m = m->fNext)
+            {
+                count += 2;
+            }
+        }
+    }
+    return count;
+}
+
+size_t GrTriangulator::countMaxTriangleIndices(const Poly* polys) const
 {
     return CountPoints(polys, fFillRule);
 }
@@ -2183,30 +2269,26 @@ size_t GrTriangulator::countMaxTriangleVertices(const Poly* polys) const
 size_t GrTriangulator::polysToTriangles(
     const Poly* polys,
     uint64_t maxVertexCount,
+    uint64_t maxIndexCount,
     uint16_t pathID,
     bool reverseTriangles,
-    pls::WriteOnlyMappedMemory<pls::TriangleVertex>* mappedMemory) const
+    pls::WriteOnlyMappedMemory<pls::TriangleVertex>* vertexMemory,
+    pls::WriteOnlyMappedMemory<uint32_t>* indexMemory) const
 {
-    if (0 == maxVertexCount || maxVertexCount > std::numeric_limits<int32_t>::max())
+    if (0 == maxIndexCount || maxIndexCount > std::numeric_limits<int32_t>::max())
     {
         return 0;
     }
 
-    TESS_LOG("emitting %d verts\n", count);
-
-    size_t vertexStride = sizeof(pls::TriangleVertex);
-#if 0
-    if (fEmitCoverage)
-    {
-        vertexStride += sizeof(float);
-    }
-#endif
+    TESS_LOG("emitting at most %d verts, %d indices\n", maxVertexCount, maxIndexCount);
 
-    size_t start = mappedMemory->bytesWritten();
-    polysToTriangles(polys, fFillRule, pathID, reverseTriangles, mappedMemory);
-    size_t actualCount = (mappedMemory->bytesWritten() - start) / vertexStride;
-    assert(actualCount <= maxVertexCount * vertexStride);
-    return actualCount;
+    RIVE_DEBUG_CODE(size_t startVertex = vertexMemory->elementsWritten();)
+    size_t startIndex = indexMemory->elementsWritten();
+    polysToTriangles(polys, fFillRule, pathID, reverseTriangles, vertexMemory, indexMemory);
+    assert(vertexMemory->elementsWritten() - startVertex <= maxVertexCount);
+    size_t actualIndexCount = indexMemory->elementsWritten() - startIndex;
+    assert(actualIndexCount <= maxIndexCount);
+    return actualIndexCount;
 }
 } // namespace rive
 
@@ -91,7 +91,7 @@ protected:
                             VertexList* back,
                             VertexList* result,
                             const Comparator&);
-    static void SortMesh(VertexList* vertices, const Comparator&);
+    void sortMesh(VertexList* vertices, const Comparator&) const;
 
     // 4) Simplify the mesh by inserting new vertices at intersecting edges:
     enum class SimplifyResult
@@ -106,15 +106,19 @@ protected:
     // 5) Tessellate the simplified mesh into monotone polygons:
     virtual std::tuple<Poly*, bool> tessellate(const VertexList& vertices, const Comparator&);
 
-    // 6) Triangulate the monotone polygons directly into a vertex buffer:
+    // 6) Triangulate the monotone polygons directly into vertex and index buffers. Each monotone
+    //    polygon writes its vertices once, followed by absolute indices for its triangles:
     void polysToTriangles(const Poly* polys,
                           FillRule overrideFillRule,
                           uint16_t pathID,
                           bool reverseTriangles,
-                          pls::WriteOnlyMappedMemory<pls::TriangleVertex>*) const;
+                          pls::WriteOnlyMappedMemory<pls::TriangleVertex>*,
+                          pls::WriteOnlyMappedMemory<uint32_t>*) const;
 
-    // The vertex sorting in step (3) is a merge sort, since it plays well with the linked list
-    // of vertices (and the necessity of inserting new vertices on intersection).
+    // The vertex sorting in step (3) gathers the linked list of vertices into an array (from
+    // fAlloc, like everything else), radix sorts it by a key that matches the sweep comparator
+    // (small meshes use a comparison sort instead), and relinks the list in sorted order. The
+    // vertices stay in a linked list because new ones get inserted on intersection.
     //
     // Stages (4) and (5) use an active edge list -- a list of all edges for which the
     // sweep line has crossed the top vertex, but not the bottom vertex.  It's sorted
@@ -160,18 +164,18 @@ protected:
     void emitMonotonePoly(const MonotonePoly*,
                           uint16_t pathID,
                           bool reverseTriangles,
-                          pls::WriteOnlyMappedMemory<pls::TriangleVertex>*) const;
+                          pls::WriteOnlyMappedMemory<pls::TriangleVertex>*,
+                          pls::WriteOnlyMappedMemory<uint32_t>*) const;
     void emitTriangle(Vertex* prev,
                       Vertex* curr,
                       Vertex* next,
-                      int winding,
-                      uint16_t pathID,
                       bool reverseTriangles,
-                      pls::WriteOnlyMappedMemory<pls::TriangleVertex>*) const;
+                      pls::WriteOnlyMappedMemory<uint32_t>*) const;
     void emitPoly(const Poly*,
                   uint16_t pathID,
                   bool reverseTriangles,
-                  pls::WriteOnlyMappedMemory<pls::TriangleVertex>*) const;
+                  pls::WriteOnlyMappedMemory<pls::TriangleVertex>*,
+                  pls::WriteOnlyMappedMemory<uint32_t>*) const;
 
     Poly* makePoly(Poly** head, Vertex* v, int winding) const;
     void appendPointToContour(const Vec2D& p, VertexList* contour) const;
@@ -255,11 +259,15 @@ protected:
                                         bool* isLinear);
     static int64_t CountPoints(const Poly* polys, FillRule overrideFillRule);
     size_t countMaxTriangleVertices(const Poly*) const;
+    size_t countMaxTriangleIndices(const Poly*) const;
+    // Returns the number of indices written.
     size_t polysToTriangles(const Poly*,
                             uint64_t maxVertexCount,
+                            uint64_t maxIndexCount,
                             uint16_t pathID,
                             bool reverseTriangles,
-                            pls::WriteOnlyMappedMemory<pls::TriangleVertex>*) const;
+                            pls::WriteOnlyMappedMemory<pls::TriangleVertex>*,
+                            pls::WriteOnlyMappedMemory<uint32_t>*) const;
 
     Comparator::Direction fDirection;
     FillRule fFillRule;
@@ -310,7 +318,13 @@ protected:
 
         void append(TrivialBlockAllocator* alloc, Vec2D a, Vec2D b, Vec2D c, int winding)
         {
-            if (a == b || a == c || b == c || winding == 0)
+            // Splitting an edge at a point that lies exactly on it (which is common with
+            // axis-aligned edges and fPreserveCollinearVertices) produces a zero-area triangle.
+            // It doesn't contribute to any pixel's winding number, so don't spend a patch on it.
+            // This also catches triangles with duplicate points.
+            Vec2D ab = b - a, ac = c - a;
+            if (winding == 0 ||
+                static_cast<double>(ab.x) * ac.y == static_cast<double>(ab.y) * ac.x)
             {
                 return;
             }
@@ -354,8 +368,8 @@ protected:
 /**
  * Vertices are used in three ways: first, the path contours are converted into a
  * circularly-linked list of Vertices for each contour. After edge construction, the same Vertices
- * are re-ordered by the merge sort according to the sweep_lt comparator (usually, increasing
- * in Y) using the same fPrev/fNext pointers that were used for the contours, to avoid
+ * are sorted according to the sweep_lt comparator (usually, increasing in Y) and relinked in
+ * order using the same fPrev/fNext pointers that were used for the contours, to avoid
  * reallocation. Finally, MonotonePolys are built containing a circularly-linked list of
  * Vertices. (Currently, those Vertices are newly-allocated for the MonotonePolys, since
  * an individual Vertex from the path mesh may belong to multiple
@@ -376,7 +390,8 @@ struct GrTriangulator::Vertex
         fRightEnclosingEdge(nullptr),
         fPartner(nullptr),
         fAlpha(alpha),
-        fSynthetic(false)
+        fSynthetic(false),
+        fIndex(0)
 #if TRIANGULATOR_LOGGING
         ,
         fID(-1.0f)
@@ -394,6 +409,7 @@ struct GrTriangulator::Vertex
     Vertex* fPartner;          // Corresponding inner or outer vertex (for AA).
     uint8_t fAlpha;
     bool fSynthetic; // Is this a synthetic vertex?
+    uint32_t fIndex; // Location in the vertex buffer of the monotone polygon being emitted.
 #if TRIANGULATOR_LOGGING
     float fID; // Identifier used for logging.
 #endif
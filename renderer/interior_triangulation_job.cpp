@@ -0,0 +1,37 @@
+/*
+ * Copyright 2024 Rive
+ */
+
+#include "interior_triangulation_job.hpp"
+
+#include <chrono>
+
+namespace rive::pls
+{
+void InteriorTriangulationJob::run()
+{
+    auto startTime = std::chrono::steady_clock::now();
+    auto* triangulator = m_allocator.make<GrInnerFanTriangulator>(m_path,
+                                                                   m_matrix,
+                                                                   m_direction,
+                                                                   m_fillRule,
+                                                                   &m_allocator,
+                                                                   m_groutTriangles);
+    auto elapsed = std::chrono::steady_clock::now() - startTime;
+    {
+        std::lock_guard lock(m_mutex);
+        assert(!m_finished);
+        m_triangulator = triangulator;
+        m_secondsElapsed = std::chrono::duration<double>(elapsed).count();
+        m_finished = true;
+    }
+    m_finishedCondition.notify_all();
+}
+
+GrInnerFanTriangulator* InteriorTriangulationJob::wait()
+{
+    std::unique_lock lock(m_mutex);
+    m_finishedCondition.wait(lock, [this] { return m_finished; });
+    return m_triangulator;
+}
+} // namespace rive::pls
@@ -0,0 +1,67 @@
+/*
+ * Copyright 2024 Rive
+ */
+
+#pragma once
+
+#include "gr_inner_fan_triangulator.hpp"
+#include "rive/math/mat2d.hpp"
+#include "rive/math/raw_path.hpp"
+#include "rive/pls/trivial_block_allocator.hpp"
+
+#include <condition_variable>
+#include <mutex>
+
+namespace rive::pls
+{
+// Triangulates the (already linearized) inner polygon of an InteriorTriangulationDraw on a worker
+// thread. The job owns its path and the allocator that the triangulation lives in, so the render
+// thread can keep building up the frame while it runs. Jobs are owned by the PLSRenderContext and
+// live until the end of the frame.
+class InteriorTriangulationJob
+{
+public:
+    InteriorTriangulationJob(const Mat2D& matrix,
+                             GrTriangulator::Comparator::Direction direction,
+                             FillRule fillRule,
+                             GrInnerFanTriangulator::GroutTriangles groutTriangles) :
+        m_matrix(matrix),
+        m_direction(direction),
+        m_fillRule(fillRule),
+        m_groutTriangles(groutTriangles)
+    {}
+
+    InteriorTriangulationJob(const InteriorTriangulationJob&) = delete;
+    InteriorTriangulationJob& operator=(const InteriorTriangulationJob&) = delete;
+
+    // The draw writes its linearized path here before the job starts.
+    RawPath* path() { return &m_path; }
+
+    // Builds the triangulation. Called once, on a worker thread.
+    void run();
+
+    // Blocks until run() has finished, then returns the triangulator.
+    GrInnerFanTriangulator* wait();
+
+    // CPU time that run() took, for PLSRenderContext::recordInteriorTriangulationTime(). Only valid
+    // after wait().
+    double secondsElapsed() const { return m_secondsElapsed; }
+
+private:
+    constexpr static size_t kInitialAllocatorBlockSize = 64 * 1024; // 64 KiB.
+
+    RawPath m_path;
+    const Mat2D m_matrix;
+    const GrTriangulator::Comparator::Direction m_direction;
+    const FillRule m_fillRule;
+    const GrInnerFanTriangulator::GroutTriangles m_groutTriangles;
+
+    TrivialBlockAllocator m_allocator{kInitialAllocatorBlockSize};
+    GrInnerFanTriangulator* m_triangulator = nullptr;
+    double m_secondsElapsed = 0;
+
+    std::mutex m_mutex;
+    std::condition_variable m_finishedCondition;
+    bool m_finished = false;
+};
+} // namespace rive::pls
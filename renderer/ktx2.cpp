@@ -0,0 +1,125 @@
+/*
+ * Copyright 2024 Rive
+ */
+
+#include "ktx2.hpp"
+
+#include <algorithm>
+#include <string.h>
+
+namespace rive::pls
+{
+constexpr static uint8_t kKTX2Identifier[12] =
+    {0xAB, 0x4B, 0x54, 0x58, 0x20, 0x32, 0x30, 0xBB, 0x0D, 0x0A, 0x1A, 0x0A};
+
+constexpr static size_t kKTX2HeaderSize = 80;
+constexpr static size_t kKTX2LevelIndexEntrySize = 24;
+
+// VkFormat values of the block-compressed formats we support.
+constexpr static uint32_t VK_FORMAT_BC1_RGBA_UNORM_BLOCK = 133;
+constexpr static uint32_t VK_FORMAT_BC3_UNORM_BLOCK = 137;
+constexpr static uint32_t VK_FORMAT_BC7_UNORM_BLOCK = 145;
+constexpr static uint32_t VK_FORMAT_ETC2_R8G8B8_UNORM_BLOCK = 147;
+constexpr static uint32_t VK_FORMAT_ETC2_R8G8B8A8_UNORM_BLOCK = 151;
+constexpr static uint32_t VK_FORMAT_ASTC_4x4_UNORM_BLOCK = 157;
+
+template <typename T> static T read_le(const uint8_t* bytes)
+{
+    // KTX2 is little endian, as are all the platforms we run on.
+    T value;
+    memcpy(&value, bytes, sizeof(T));
+    return value;
+}
+
+static bool vk_format_to_compressed_texture_format(uint32_t vkFormat,
+                                                   CompressedTextureFormat* format)
+{
+    switch (vkFormat)
+    {
+        case VK_FORMAT_BC1_RGBA_UNORM_BLOCK:
+            *format = CompressedTextureFormat::bc1RGBA;
+            return true;
+        case VK_FORMAT_BC3_UNORM_BLOCK:
+            *format = CompressedTextureFormat::bc3RGBA;
+            return true;
+        case VK_FORMAT_BC7_UNORM_BLOCK:
+            *format = CompressedTextureFormat::bc7RGBA;
+            return true;
+        case VK_FORMAT_ETC2_R8G8B8_UNORM_BLOCK:
+            *format = CompressedTextureFormat::etc2RGB8;
+            return true;
+        case VK_FORMAT_ETC2_R8G8B8A8_UNORM_BLOCK:
+            *format = CompressedTextureFormat::etc2RGBA8;
+            return true;
+        case VK_FORMAT_ASTC_4x4_UNORM_BLOCK:
+            *format = CompressedTextureFormat::astc4x4RGBA;
+            return true;
+    }
+    return false;
+}
+
+bool IsKTX2(Span<const uint8_t> encodedBytes)
+{
+    return encodedBytes.size() >= sizeof(kKTX2Identifier) &&
+           memcmp(encodedBytes.data(), kKTX2Identifier, sizeof(kKTX2Identifier)) == 0;
+}
+
+bool ParseKTX2(Span<const uint8_t> encodedBytes, KTX2Image* image)
+{
+    if (!IsKTX2(encodedBytes) || encodedBytes.size() < kKTX2HeaderSize)
+    {
+        return false;
+    }
+    const uint8_t* header = encodedBytes.data();
+    uint32_t vkFormat = read_le<uint32_t>(header + 12);
+    uint32_t pixelWidth = read_le<uint32_t>(header + 20);
+    uint32_t pixelHeight = read_le<uint32_t>(header + 24);
+    uint32_t pixelDepth = read_le<uint32_t>(header + 28);
+    uint32_t layerCount = read_le<uint32_t>(header + 32);
+    uint32_t faceCount = read_le<uint32_t>(header + 36);
+    uint32_t levelCount = read_le<uint32_t>(header + 40);
+    uint32_t supercompressionScheme = read_le<uint32_t>(header + 44);
+
+    if (!vk_format_to_compressed_texture_format(vkFormat, &image->format) || pixelWidth == 0 ||
+        pixelHeight == 0 || pixelDepth != 0 || layerCount > 1 || faceCount != 1 ||
+        supercompressionScheme != 0)
+    {
+        return false;
+    }
+
+    // A levelCount of 0 asks the loader to generate mipmaps, which we can't do for compressed
+    // formats. Just use the base level.
+    uint32_t levelsInFile = std::max(levelCount, 1u);
+    if (levelsInFile > 32 ||
+        encodedBytes.size() < kKTX2HeaderSize + levelsInFile * kKTX2LevelIndexEntrySize)
+    {
+        return false;
+    }
+
+    image->width = pixelWidth;
+    image->height = pixelHeight;
+    image->mipLevels.clear();
+    image->mipLevels.reserve(levelsInFile);
+    for (uint32_t level = 0; level < levelsInFile; ++level)
+    {
+        const uint8_t* entry = header + kKTX2HeaderSize + level * kKTX2LevelIndexEntrySize;
+        uint64_t byteOffset = read_le<uint64_t>(entry);
+        uint64_t byteLength = read_le<uint64_t>(entry + 8);
+        uint32_t levelWidth = std::max(pixelWidth >> level, 1u);
+        uint32_t levelHeight = std::max(pixelHeight >> level, 1u);
+        if (byteLength !=
+                CompressedTextureLevelSizeInBytes(image->format, levelWidth, levelHeight) ||
+            byteOffset > encodedBytes.size() || byteLength > encodedBytes.size() - byteOffset)
+        {
+            return false;
+        }
+        image->mipLevels.push_back(
+            Span<const uint8_t>(header + byteOffset, static_cast<size_t>(byteLength)));
+        if (levelWidth == 1 && levelHeight == 1)
+        {
+            break;
+        }
+    }
+    return true;
+}
+} // namespace rive::pls
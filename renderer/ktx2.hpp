@@ -0,0 +1,29 @@
+/*
+ * Copyright 2024 Rive
+ */
+
+#pragma once
+
+#include "rive/pls/pls.hpp"
+#include "rive/span.hpp"
+#include <vector>
+
+namespace rive::pls
+{
+// Block-compressed image parsed out of a KTX2 container. The mip levels point into the original
+// encoded bytes, which must outlive this object.
+struct KTX2Image
+{
+    CompressedTextureFormat format;
+    uint32_t width;
+    uint32_t height;
+    std::vector<Span<const uint8_t>> mipLevels; // Largest (level 0) first.
+};
+
+// Returns true if the bytes begin with the KTX2 file identifier.
+bool IsKTX2(Span<const uint8_t> encodedBytes);
+
+// Parses a 2D, non-array, non-cubemap KTX2 file with no supercompression, whose vkFormat maps to a
+// CompressedTextureFormat. Returns false if the file is malformed or unsupported.
+bool ParseKTX2(Span<const uint8_t> encodedBytes, KTX2Image*);
+} // namespace rive::pls
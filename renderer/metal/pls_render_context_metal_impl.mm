@@ -266,7 +266,7 @@ protected:
         return m_buffers[bufferIdx].contents;
     }
 
-    void onUnmapAndSubmitBuffer(int bufferIdx, size_t mapSizeInBytes) override {}
+    void onUnmapAndSubmitBuffer(int bufferIdx, size_t updateSizeInBytes) override {}
 
 private:
     id<MTLBuffer> m_buffers[kBufferRingSize];
@@ -304,6 +304,23 @@ PLSRenderContextMetalImpl::PLSRenderContextMetalImpl(id<MTLDevice> gpu,
         [m_gpu supportsFamily:MTLGPUFamilyApple1] && !contextOptions.disableFramebufferReads;
 #endif
     m_platformFeatures.atomicPLSMustBeInitializedAsDraw = true;
+    if ([m_gpu supportsFamily:MTLGPUFamilyApple2])
+    {
+        m_platformFeatures.compressedTextureFormats |=
+            1 << static_cast<int>(CompressedTextureFormat::etc2RGB8) |
+            1 << static_cast<int>(CompressedTextureFormat::etc2RGBA8) |
+            1 << static_cast<int>(CompressedTextureFormat::astc4x4RGBA);
+    }
+    if (@available(macOS 11, iOS 16.4, *))
+    {
+        if (m_gpu.supportsBCTextureCompression)
+        {
+            m_platformFeatures.compressedTextureFormats |=
+                1 << static_cast<int>(CompressedTextureFormat::bc1RGBA) |
+                1 << static_cast<int>(CompressedTextureFormat::bc3RGBA) |
+                1 << static_cast<int>(CompressedTextureFormat::bc7RGBA);
+        }
+    }
 
 #ifdef RIVE_IOS
     // Atomic barriers are never used on iOS, but if we ever did need them, we would use
@@ -546,6 +563,41 @@ public:
                      bytesPerRow:width * 4];
     }
 
+    PLSTextureMetalImpl(id<MTLDevice> gpu,
+                        uint32_t width,
+                        uint32_t height,
+                        MTLPixelFormat compressedPixelFormat,
+                        CompressedTextureFormat format,
+                        const Span<const uint8_t> mipLevels[],
+                        uint32_t mipLevelCount) :
+        PLSTexture(width, height)
+    {
+        MTLTextureDescriptor* desc = [[MTLTextureDescriptor alloc] init];
+        desc.pixelFormat = compressedPixelFormat;
+        desc.width = width;
+        desc.height = height;
+        desc.mipmapLevelCount = mipLevelCount;
+        desc.usage = MTLTextureUsageShaderRead;
+        desc.storageMode = MTLStorageModeShared;
+        desc.textureType = MTLTextureType2D;
+        m_texture = [gpu newTextureWithDescriptor:desc];
+
+        // Compressed textures can't generate mipmaps on the GPU, so upload every level as-is.
+        for (uint32_t level = 0; level < mipLevelCount; ++level)
+        {
+            uint32_t levelWidth = std::max(width >> level, 1u);
+            uint32_t levelHeight = std::max(height >> level, 1u);
+            uint32_t blocksWide =
+                (levelWidth + kCompressedTextureBlockDim - 1) / kCompressedTextureBlockDim;
+            MTLRegion region = MTLRegionMake2D(0, 0, levelWidth, levelHeight);
+            [m_texture replaceRegion:region
+                         mipmapLevel:level
+                           withBytes:mipLevels[level].data()
+                         bytesPerRow:blocksWide * CompressedTextureBlockSizeInBytes(format)];
+        }
+        m_mipsDirty = false;
+    }
+
     void ensureMipmaps(id<MTLCommandBuffer> commandBuffer) const
     {
         if (m_mipsDirty)
@@ -573,6 +625,43 @@ rcp<PLSTexture> PLSRenderContextMetalImpl::makeImageTexture(uint32_t width,
     return make_rcp<PLSTextureMetalImpl>(m_gpu, width, height, mipLevelCount, imageDataRGBA);
 }
 
+static MTLPixelFormat compressed_texture_pixel_format(CompressedTextureFormat format)
+{
+    switch (format)
+    {
+        case CompressedTextureFormat::bc1RGBA:
+            return MTLPixelFormatBC1_RGBA;
+        case CompressedTextureFormat::bc3RGBA:
+            return MTLPixelFormatBC3_RGBA;
+        case CompressedTextureFormat::bc7RGBA:
+            return MTLPixelFormatBC7_RGBAUnorm;
+        case CompressedTextureFormat::etc2RGB8:
+            return MTLPixelFormatETC2_RGB8;
+        case CompressedTextureFormat::etc2RGBA8:
+            return MTLPixelFormatEAC_RGBA8;
+        case CompressedTextureFormat::astc4x4RGBA:
+            return MTLPixelFormatASTC_4x4_LDR;
+    }
+    RIVE_UNREACHABLE();
+}
+
+rcp<PLSTexture> PLSRenderContextMetalImpl::makeCompressedImageTexture(
+    uint32_t width,
+    uint32_t height,
+    CompressedTextureFormat format,
+    const Span<const uint8_t> mipLevels[],
+    uint32_t mipLevelCount)
+{
+    assert(m_platformFeatures.supportsCompressedTextureFormat(format));
+    return make_rcp<PLSTextureMetalImpl>(m_gpu,
+                                         width,
+                                         height,
+                                         compressed_texture_pixel_format(format),
+                                         format,
+                                         mipLevels,
+                                         mipLevelCount);
+}
+
 std::unique_ptr<BufferRing> PLSRenderContextMetalImpl::makeUniformBufferRing(size_t capacityInBytes)
 {
     return BufferRingMetalImpl::Make(m_gpu, capacityInBytes);
@@ -1077,12 +1166,16 @@ void PLSRenderContextMetalImpl::flush(const FlushDescriptor& desc)
             }
             case DrawType::interiorTriangulation:
             {
+                LITE_RTTI_CAST_OR_BREAK(
+                    indexBuffer, const RenderBufferMetalImpl*, batch.indexBuffer);
                 [encoder setRenderPipelineState:drawPipelineState];
                 [encoder setVertexBuffer:mtl_buffer(triangleBufferRing()) offset:0 atIndex:0];
                 [encoder setCullMode:MTLCullModeBack];
-                [encoder drawPrimitives:MTLPrimitiveTypeTriangle
-                            vertexStart:batch.baseElement
-                            vertexCount:batch.elementCount];
+                [encoder drawIndexedPrimitives:MTLPrimitiveTypeTriangle
+                                    indexCount:batch.elementCount
+                                     indexType:MTLIndexTypeUInt32
+                                   indexBuffer:indexBuffer->submittedBuffer()
+                             indexBufferOffset:batch.baseElement * sizeof(uint32_t)];
                 break;
             }
             case DrawType::imageRect:
@@ -1113,8 +1206,12 @@ void PLSRenderContextMetalImpl::flush(const FlushDescriptor& desc)
                     LITE_RTTI_CAST_OR_BREAK(uvBuffer, const RenderBufferMetalImpl*, batch.uvBuffer);
                     LITE_RTTI_CAST_OR_BREAK(
                         indexBuffer, const RenderBufferMetalImpl*, batch.indexBuffer);
-                    [encoder setVertexBuffer:vertexBuffer->submittedBuffer() offset:0 atIndex:0];
-                    [encoder setVertexBuffer:uvBuffer->submittedBuffer() offset:0 atIndex:1];
+                    [encoder setVertexBuffer:vertexBuffer->submittedBuffer()
+                                      offset:batch.vertexDataOffsetInBytes
+                                     atIndex:0];
+                    [encoder setVertexBuffer:uvBuffer->submittedBuffer()
+                                      offset:batch.vertexDataOffsetInBytes
+                                     atIndex:1];
                     [encoder drawIndexedPrimitives:MTLPrimitiveTypeTriangle
                                         indexCount:batch.elementCount
                                          indexType:MTLIndexTypeUInt16
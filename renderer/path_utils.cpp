@@ -155,6 +155,72 @@ float MeasureAngleBetweenVectors(Vec2D a, Vec2D b)
     return acosf(cosTheta);
 }
 
+bool IsConvexPolygon(const Vec2D pts[], size_t count, float* signedArea)
+{
+    assert(signedArea);
+    float turnDirection = 0;
+    int xDirectionChanges = 0, yDirectionChanges = 0;
+    float lastDX = 0, lastDY = 0;
+    Vec2D firstEdge = {0, 0}, lastEdge = {0, 0};
+    float area = 0;
+    // Returns false if 'edge' turns against the polygon's established direction.
+    auto turnTo = [&](Vec2D edge) {
+        float cross = Vec2D::cross(lastEdge, edge);
+        if (cross == 0)
+        {
+            // Collinear edges are fine, as long as they don't double back.
+            return Vec2D::dot(lastEdge, edge) > 0;
+        }
+        if (turnDirection == 0)
+        {
+            turnDirection = cross;
+        }
+        return (cross > 0) == (turnDirection > 0);
+    };
+    // Counts how many times the edges change direction along each axis. A polygon that winds once
+    // changes direction exactly twice in each.
+    auto countDirectionChange = [](float d, float* lastD, int* changes) {
+        if (d != 0)
+        {
+            if (*lastD != 0 && (d > 0) != (*lastD > 0))
+            {
+                ++*changes;
+            }
+            *lastD = d;
+        }
+    };
+    for (size_t i = 0; i < count; ++i)
+    {
+        Vec2D p = pts[i], next = pts[i + 1 < count ? i + 1 : 0];
+        area += Vec2D::cross(p - pts[0], next - pts[0]);
+        Vec2D edge = next - p;
+        if (edge.x == 0 && edge.y == 0)
+        {
+            continue;
+        }
+        if (lastEdge.x == 0 && lastEdge.y == 0)
+        {
+            firstEdge = edge;
+        }
+        else if (!turnTo(edge))
+        {
+            return false;
+        }
+        countDirectionChange(edge.x, &lastDX, &xDirectionChanges);
+        countDirectionChange(edge.y, &lastDY, &yDirectionChanges);
+        lastEdge = edge;
+    }
+    // Close the loop.
+    if (!turnTo(firstEdge))
+    {
+        return false;
+    }
+    countDirectionChange(firstEdge.x, &lastDX, &xDirectionChanges);
+    countDirectionChange(firstEdge.y, &lastDY, &yDirectionChanges);
+    *signedArea = area * .5f;
+    return xDirectionChanges <= 2 && yDirectionChanges <= 2;
+}
+
 int FindCubicConvex180Chops(const Vec2D pts[], float T[2], bool* areCusps)
 {
     assert(pts);
@@ -301,6 +367,108 @@ int FindCubicConvex180Chops(const Vec2D pts[], float T[2], bool* areCusps)
     return 0;
 }
 
+void FindCubicConvex180Chops4(const Vec2D* const pts[4],
+                              float T[4][2],
+                              bool areCusps[4],
+                              int numChops[4])
+{
+    // Same constants as FindCubicConvex180Chops().
+    constexpr static float kEpsilon = 1.f / (1 << 10);
+    constexpr static uint32_t kIEEE_one_minus_2_epsilon = (127 << 23) - 2 * (1 << (24 - 10));
+
+    // Transpose the 4 cubics into structure-of-arrays form.
+    float4 x0, y0, x1, y1, x2, y2, x3, y3;
+    for (int i = 0; i < 4; ++i)
+    {
+        x0[i] = pts[i][0].x;
+        y0[i] = pts[i][0].y;
+        x1[i] = pts[i][1].x;
+        y1[i] = pts[i][1].y;
+        x2[i] = pts[i][2].x;
+        y2[i] = pts[i][2].y;
+        x3[i] = pts[i][3].x;
+        y3[i] = pts[i][3].y;
+    }
+
+    // Power basis coefficients and inflection function. (See FindCubicConvex180Chops().)
+    float4 Cx = x1 - x0, Cy = y1 - y0;
+    float4 Dx = x2 - x1, Dy = y2 - y1;
+    float4 Ex = x3 - x0, Ey = y3 - y0;
+    float4 Bx = Dx - Cx, By = Dy - Cy;
+    float4 Ax = -3.f * Dx + Ex, Ay = -3.f * Dy + Ey;
+    float4 a = Ax * By - Ay * Bx;
+    float4 b = Ax * Cy - Ay * Cx;
+    float4 c = Bx * Cy - By * Cx;
+    float4 b_over_minus_2 = -.5f * b;
+    float4 discr_over_4 = b_over_minus_2 * b_over_minus_2 - a * c;
+    float4 cuspThreshold = a * (kEpsilon / 2);
+    cuspThreshold *= cuspThreshold;
+
+    // Candidate roots for every branch of the scalar version. Each lane only uses one of them.
+    //
+    // No inflection or cusp: the point of 180-degree rotation.
+    float4 rotationRoot = c / b_over_minus_2;
+    // Cusp: the average of both roots.
+    float4 cuspRoot = b_over_minus_2 / a;
+    // Inflections: Numerical Recipes quadratic formula.
+    float4 q = simd::sqrt(discr_over_4);
+    q = math::bit_cast<float4>((math::bit_cast<uint4>(q) & 0x7fffffffu) |
+                               (math::bit_cast<uint4>(b_over_minus_2) & 0x80000000u));
+    q = q + b_over_minus_2;
+    float4 roots0 = q / a;
+    float4 roots1 = c / q;
+
+    for (int i = 0; i < 4; ++i)
+    {
+        auto isInRange = [](float root) {
+            // Is "root" inside the range [kEpsilon, 1 - kEpsilon)?
+            return math::bit_cast<uint32_t>(root - kEpsilon) < kIEEE_one_minus_2_epsilon;
+        };
+        if (discr_over_4[i] < -cuspThreshold[i])
+        {
+            areCusps[i] = false;
+            numChops[i] = isInRange(rotationRoot[i]) ? 1 : 0;
+            T[i][0] = rotationRoot[i];
+            continue;
+        }
+        areCusps[i] = discr_over_4[i] <= cuspThreshold[i];
+        if (areCusps[i])
+        {
+            if (a[i] != 0 || b_over_minus_2[i] != 0 || c[i] != 0)
+            {
+                numChops[i] = isInRange(cuspRoot[i]) ? 1 : 0;
+                T[i][0] = cuspRoot[i];
+            }
+            else
+            {
+                // Flat lines are rare. Let the scalar version search for their cusps.
+                bool flatLineAreCusps;
+                numChops[i] = FindCubicConvex180Chops(pts[i], T[i], &flatLineAreCusps);
+                assert(flatLineAreCusps);
+            }
+            continue;
+        }
+        float r0 = roots0[i], r1 = roots1[i];
+        bool inside0 = r0 > kEpsilon && r0 < 1 - kEpsilon;
+        bool inside1 = r1 > kEpsilon && r1 < 1 - kEpsilon;
+        if (inside0 && inside1 && r0 != r1)
+        {
+            T[i][0] = std::min(r0, r1);
+            T[i][1] = std::max(r0, r1);
+            numChops[i] = 2;
+        }
+        else if (inside0 || inside1)
+        {
+            T[i][0] = inside0 ? r0 : r1;
+            numChops[i] = 1;
+        }
+        else
+        {
+            numChops[i] = 0;
+        }
+    }
+}
+
 #if 0
 namespace
 {
@@ -57,6 +57,20 @@ float MeasureAngleBetweenVectors(Vec2D a, Vec2D b);
 // point(s) occurred at 180-degree turnaround points on a degenerate flat line.
 int FindCubicConvex180Chops(const Vec2D[], float T[2], bool* areCusps);
 
+// Batched version of FindCubicConvex180Chops() that evaluates 4 cubics at once, using 4-lane SIMD
+// for the inflection function and root solving. Produces the same results as calling
+// FindCubicConvex180Chops() on each cubic individually.
+void FindCubicConvex180Chops4(const Vec2D* const pts[4],
+                              float T[4][2],
+                              bool areCusps[4],
+                              int numChops[4]);
+
+// Returns true if the closed polygon through 'pts' is convex, i.e., every turn goes in the same
+// direction and it winds exactly once. Duplicate and collinear points are allowed, but an edge that
+// doubles back on the one before it is not. Also returns the polygon's signed area, which is
+// positive if the polygon is clockwise in a y-down coordinate system.
+bool IsConvexPolygon(const Vec2D pts[], size_t count, float* signedArea);
+
 #if 0
 // Returns a new path, equivalent to 'path' within the given viewport, whose verbs can all be drawn
 // with 'maxSegments' tessellation segments or fewer, while staying within '1/tessellationPrecision'
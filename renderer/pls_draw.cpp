@@ -5,6 +5,7 @@
 #include "rive/pls/pls_draw.hpp"
 
 #include "gr_inner_fan_triangulator.hpp"
+#include "interior_triangulation_job.hpp"
 #include "path_utils.hpp"
 #include "pls_path.hpp"
 #include "pls_paint.hpp"
@@ -12,6 +13,10 @@
 #include "rive/pls/pls_image.hpp"
 #include "shaders/constants.glsl"
 
+#include <chrono>
+#include <memory>
+#include <optional>
+
 namespace rive::pls
 {
 namespace
@@ -273,6 +278,205 @@ RIVE_ALWAYS_INLINE uint32_t join_type_flags(StrokeJoin join)
     }
     RIVE_UNREACHABLE();
 }
+
+// Evaluates Wang's formula for cubics 4 at a time, in structure-of-arrays form.
+//
+// Cubics are pushed one at a time (which only copies their points into a lane), and each time the
+// 4th lane fills up, all 4 cubics are evaluated in one shot. Since every contour's curves begin on
+// a multiple of 4 in the parametric segment counts array, a cubic's lane is just its curve index
+// mod 4.
+//
+// Like wangs_formula::cubic_pow4(), this records n^4; the 4th root is taken later, also in batches
+// of 4.
+class WangsFormulaCubicBatch
+{
+public:
+    WangsFormulaCubicBatch(const Mat2D& matrix, uint32_t* parametricSegmentCounts) :
+        m_xx(matrix.xx()),
+        m_xy(matrix.xy()),
+        m_yx(matrix.yx()),
+        m_yy(matrix.yy()),
+        m_parametricSegmentCounts(parametricSegmentCounts)
+    {}
+
+    RIVE_ALWAYS_INLINE void push(const Vec2D pts[4], size_t curveIdx)
+    {
+        size_t lane = curveIdx & 3;
+        RIVE_INLINE_MEMCPY(m_p01[lane], pts, sizeof(m_p01[lane]));
+        RIVE_INLINE_MEMCPY(m_p23[lane], pts + 2, sizeof(m_p23[lane]));
+        if (lane == 3)
+        {
+            evaluate(curveIdx - 3);
+        }
+    }
+
+    // Evaluates any cubics still waiting in lanes. 'curveIdx' is one past the final curve pushed
+    // so far. Unused lanes get n^4 = 0.
+    void flush(size_t curveIdx)
+    {
+        size_t lane = curveIdx & 3;
+        if (lane != 0)
+        {
+            memset(m_p01[lane], 0, sizeof(m_p01[0]) * (4 - lane));
+            memset(m_p23[lane], 0, sizeof(m_p23[0]) * (4 - lane));
+            evaluate(curveIdx - lane);
+        }
+    }
+
+private:
+    void evaluate(size_t firstCurveIdx)
+    {
+        auto [x0, y0, x1, y1] = simd::load4x4f(m_p01[0]);
+        auto [x2, y2, x3, y3] = simd::load4x4f(m_p23[0]);
+        // Second differences of the control points, transformed by the view matrix.
+        float4 dx0 = x0 - 2.f * x1 + x2;
+        float4 dy0 = y0 - 2.f * y1 + y2;
+        float4 dx1 = x1 - 2.f * x2 + x3;
+        float4 dy1 = y1 - 2.f * y2 + y3;
+        float4 vx0 = m_xx * dx0 + m_yx * dy0;
+        float4 vy0 = m_xy * dx0 + m_yy * dy0;
+        float4 vx1 = m_xx * dx1 + m_yx * dy1;
+        float4 vy1 = m_xy * dx1 + m_yy * dy1;
+        // n^4 = (3*2/8 * precision)^2 * max(|v0|^2, |v1|^2)
+        constexpr static float kLengthTermPow2 =
+            (3 * 2 / 8.f * kParametricPrecision) * (3 * 2 / 8.f * kParametricPrecision);
+        float4 n4 = simd::max(vx0 * vx0 + vy0 * vy0, vx1 * vx1 + vy1 * vy1) * kLengthTermPow2;
+        simd::store(m_parametricSegmentCounts + firstCurveIdx, n4);
+    }
+
+    const float m_xx, m_xy, m_yx, m_yy;
+    uint32_t* const m_parametricSegmentCounts;
+    // Lanes of [x0, y0, x1, y1] and [x2, y2, x3, y3], transposed when we evaluate.
+    float m_p01[4][4];
+    float m_p23[4][4];
+};
+
+// Finds the convex-180 chops of a path's cubics in batches of 4, via
+// pathutils::FindCubicConvex180Chops4(). Cubics must be requested in path order, but may be
+// skipped (e.g., when a contour gets culled). Each time the batch runs dry, we look ahead and
+// process the next 4 cubics in the path.
+class Convex180ChopQueue
+{
+public:
+    Convex180ChopQueue(RawPath::Iter end) : m_end(end) {}
+
+    RIVE_ALWAYS_INLINE int next(RawPath::Iter iter, float T[2], bool* areCusps)
+    {
+        assert(iter.verb() == PathVerb::cubic);
+        // The look-ahead can cross into contours that never request their cubics. Points are
+        // stored in path order, so anything queued before 'iter' belongs to a skipped cubic.
+        while (m_nextIdx < m_count && m_cubicPts[m_nextIdx] < iter.cubicPts())
+        {
+            ++m_nextIdx;
+        }
+        if (m_nextIdx == m_count)
+        {
+            refill(iter);
+        }
+        assert(m_cubicPts[m_nextIdx] == iter.cubicPts());
+        T[0] = m_T[m_nextIdx][0];
+        T[1] = m_T[m_nextIdx][1];
+        *areCusps = m_areCusps[m_nextIdx];
+        return m_numChops[m_nextIdx++];
+    }
+
+private:
+    void refill(RawPath::Iter iter)
+    {
+        m_count = 0;
+        for (; iter != m_end && m_count < 4; ++iter)
+        {
+            if (iter.verb() == PathVerb::cubic)
+            {
+                m_cubicPts[m_count++] = iter.cubicPts();
+            }
+        }
+        assert(m_count > 0);
+        // Fill unused lanes with a valid cubic. Their results are ignored.
+        for (size_t i = m_count; i < 4; ++i)
+        {
+            m_cubicPts[i] = m_cubicPts[0];
+        }
+        pathutils::FindCubicConvex180Chops4(m_cubicPts, m_T, m_areCusps, m_numChops);
+        RIVE_DEBUG_CODE(validateAgainstScalarChops();)
+        m_nextIdx = 0;
+    }
+
+#ifdef DEBUG
+    // The batched chopper is supposed to reproduce FindCubicConvex180Chops() exactly, except for
+    // float rounding in the T values. (The chopper already treats T values within 1/1024 of each
+    // other as interchangeable.)
+    void validateAgainstScalarChops() const
+    {
+        for (size_t i = 0; i < m_count; ++i)
+        {
+            float T[2];
+            bool areCusps;
+            int numChops = pathutils::FindCubicConvex180Chops(m_cubicPts[i], T, &areCusps);
+            assert(m_numChops[i] == numChops);
+            assert(numChops == 0 || m_areCusps[i] == areCusps);
+            for (int j = 0; j < numChops; ++j)
+            {
+                assert(fabsf(m_T[i][j] - T[j]) <= 1.f / (1 << 10));
+            }
+        }
+    }
+#endif
+
+    const RawPath::Iter m_end;
+    size_t m_count = 0;
+    size_t m_nextIdx = 0;
+    const Vec2D* m_cubicPts[4];
+    float m_T[4][2];
+    bool m_areCusps[4];
+    int m_numChops[4];
+};
+
+// Filled paths whose device-space bounding box is smaller than this size in both dimensions cover,
+// at most, 1/64 of a pixel. Their contribution to the final coverage is invisible, so we don't
+// tessellate them at all.
+constexpr static float kSubpixelPathCullSize = 1 / 8.f;
+
+// Tests whether geometry falls entirely outside the render target, in which case it doesn't need
+// to be tessellated at full fidelity (or at all).
+class ViewportCuller
+{
+public:
+    // 'pixelOutset' grows the viewport to account for stroke width, joins, and antialiasing.
+    ViewportCuller(const PLSRenderContext* context,
+                   const IAABB& pixelBounds,
+                   const Mat2D& matrix,
+                   float pixelOutset) :
+        m_matrix(matrix)
+    {
+        const auto& desc = context->frameDescriptor();
+        // Only cull paths that cross the edge of the render target. Paths that are entirely
+        // onscreen don't pay anything for this.
+        int4 bounds = simd::load4i(&pixelBounds);
+        auto renderTargetSize =
+            simd::cast<int32_t>(uint2{desc.renderTargetWidth, desc.renderTargetHeight});
+        m_enabled = simd::any(bounds.xy < 0 || bounds.zw > renderTargetSize);
+        m_viewportLTRB = float4{-pixelOutset,
+                                -pixelOutset,
+                                static_cast<float>(desc.renderTargetWidth) + pixelOutset,
+                                static_cast<float>(desc.renderTargetHeight) + pixelOutset};
+    }
+
+    bool enabled() const { return m_enabled; }
+
+    bool isOffscreen(const Vec2D* pts, size_t count) const
+    {
+        assert(m_enabled);
+        auto [l, t, r, b] = m_matrix.mapBoundingBox(pts, count);
+        float4 ltrb = {l, t, r, b};
+        return simd::any(ltrb.zw < m_viewportLTRB.xy || ltrb.xy > m_viewportLTRB.zw);
+    }
+
+private:
+    const Mat2D m_matrix;
+    float4 m_viewportLTRB;
+    bool m_enabled;
+};
 } // namespace
 
 PLSDraw::PLSDraw(IAABB pixelBounds,
@@ -311,6 +515,13 @@ void PLSDraw::setClipID(uint32_t clipID)
     }
 }
 
+void PLSDraw::inheritFlushState(const PLSDraw& draw)
+{
+    setClipID(draw.m_clipID);
+    m_clipRectInverseMatrix = draw.m_clipRectInverseMatrix;
+    m_simplePaintValue = draw.m_simplePaintValue;
+}
+
 bool PLSDraw::allocateGradientIfNeeded(PLSRenderContext::LogicalFlush* flush,
                                        ResourceCounters* counters)
 {
@@ -368,9 +579,8 @@ PLSDrawUniquePtr PLSPathDraw::Make(PLSRenderContext* context,
         // Use interior triangulation to draw filled paths if they're large enough to benefit from
         // it.
         const AABB& localBounds = path->getBounds();
-        // FIXME! Implement interior triangulation in depthStencil mode.
-        if (context->frameInterlockMode() != pls::InterlockMode::depthStencil &&
-            pls::FindTransformedArea(localBounds, matrix) > 512 * 512)
+        if (context->shouldTriangulateInterior(pls::FindTransformedArea(localBounds, matrix),
+                                               path->getRawPath().points().count()))
         {
             return PLSDrawUniquePtr(context->make<InteriorTriangulationDraw>(
                 context,
@@ -390,7 +600,34 @@ PLSDrawUniquePtr PLSPathDraw::Make(PLSRenderContext* context,
                                                                matrix,
                                                                std::move(path),
                                                                fillRule,
-                                                               paint));
+                                                               paint,
+                                                               paint->getIsStroked()));
+}
+
+PLSDrawUniquePtr PLSPathDraw::MakeStrokeOutline(PLSRenderContext* context,
+                                                const Mat2D& matrix,
+                                                rcp<const PLSPath> outline,
+                                                const PLSPaint* paint,
+                                                RawPath* scratchPath)
+{
+    assert(outline != nullptr);
+    assert(paint != nullptr);
+    assert(paint->getIsStroked());
+    // The outline already contains the stroke's joins and caps, so its bounds don't need an
+    // outset.
+    const AABB& localBounds = outline->getBounds();
+    IAABB pixelBounds = matrix.mapBoundingBox(localBounds).roundOut();
+    return PLSDrawUniquePtr(context->make<InteriorTriangulationDraw>(
+        context,
+        pixelBounds,
+        matrix,
+        std::move(outline),
+        FillRule::nonZero,
+        paint,
+        scratchPath,
+        localBounds.width() > localBounds.height()
+            ? InteriorTriangulationDraw::TriangulatorAxis::horizontal
+            : InteriorTriangulationDraw::TriangulatorAxis::vertical));
 }
 
 PLSPathDraw::PLSPathDraw(IAABB pixelBounds,
@@ -398,21 +635,23 @@ PLSPathDraw::PLSPathDraw(IAABB pixelBounds,
                          rcp<const PLSPath> path,
                          FillRule fillRule,
                          const PLSPaint* paint,
+                         bool isStroked,
                          Type type,
                          pls::InterlockMode frameInterlockMode) :
     PLSDraw(pixelBounds, matrix, paint->getBlendMode(), ref_rcp(paint->getImageTexture()), type),
     m_pathRef(path.release()),
-    m_fillRule(paint->getIsStroked() ? FillRule::nonZero : fillRule),
+    m_fillRule(isStroked ? FillRule::nonZero : fillRule),
     m_paintType(paint->getType()),
-    m_strokeRadius(paint->getIsStroked() ? paint->getThickness() * .5f : 0)
+    m_strokeRadius(isStroked ? paint->getThickness() * .5f : 0)
 {
     assert(m_pathRef != nullptr);
     assert(paint != nullptr);
+    assert(!isStroked || paint->getIsStroked());
     if (m_blendMode == BlendMode::srcOver && paint->getIsOpaque())
     {
         m_drawContents |= pls::DrawContents::opaquePaint;
     }
-    if (paint->getIsStroked())
+    if (isStroked)
     {
         m_drawContents |= pls::DrawContents::stroke;
     }
@@ -469,7 +708,8 @@ void PLSPathDraw::pushToRenderContext(PLSRenderContext::LogicalFlush* flush)
     size_t tessVertexCount = m_type == Type::midpointFanPath
                                  ? m_resourceCounts.midpointFanTessVertexCount
                                  : m_resourceCounts.outerCubicTessVertexCount;
-    if (tessVertexCount == 0)
+    // (Flattened interior triangulations in depthStencil mode don't have any patches.)
+    if (tessVertexCount == 0 && m_resourceCounts.maxTriangleIndexCount == 0)
     {
         return;
     }
@@ -497,25 +737,65 @@ MidpointFanPathDraw::MidpointFanPathDraw(PLSRenderContext* context,
                                          const Mat2D& matrix,
                                          rcp<const PLSPath> path,
                                          FillRule fillRule,
-                                         const PLSPaint* paint) :
+                                         const PLSPaint* paint,
+                                         bool isStroked) :
     PLSPathDraw(pixelBounds,
                 matrix,
                 std::move(path),
                 fillRule,
                 paint,
+                isStroked,
                 Type::midpointFanPath,
                 context->frameInterlockMode())
 {
+    float matrixMaxScale = m_matrix.findMaxScale();
     if (isStroked())
     {
-        m_strokeMatrixMaxScale = m_matrix.findMaxScale();
+        m_strokeMatrixMaxScale = matrixMaxScale;
         m_strokeJoin = paint->getJoin();
         m_strokeCap = paint->getCap();
+        // Strokes no wider than half a pixel are drawn as hairlines: every curve gets a single
+        // polar segment, and round joins are emitted as bevels. Caps, miters, and bevels are
+        // unchanged, so thin borders keep their corners.
+        m_hairline = m_strokeRadius * 2 * matrixMaxScale <= .5f;
+    }
+
+    if (!isStroked())
+    {
+        // Level of detail: drop filled paths that are sub-pixel once transformed. The test is on
+        // the entire path rather than each contour, since many tiny contours can still add up to
+        // visible coverage (e.g., small text or particles). Strokes are never culled because a
+        // hairline-thin stroke can still be long enough to be visible.
+        AABB devBounds = m_matrix.mapBoundingBox(m_pathRef->getBounds());
+        if (devBounds.width() < kSubpixelPathCullSize &&
+            devBounds.height() < kSubpixelPathCullSize)
+        {
+            return;
+        }
     }
 
+    // Geometry outside the render target gets dropped (contours) or flattened (filled cubics).
+    // A closed contour has zero winding outside its control points' hull, so offscreen fill
+    // contours can be dropped as safely as offscreen stroke contours.
+    float cullOutset = 1; // AA ramp.
+    if (isStroked())
+    {
+        float strokeOutset = m_strokeRadius * matrixMaxScale;
+        if (m_strokeJoin == StrokeJoin::miter)
+        {
+            strokeOutset *= 4;
+        }
+        else if (m_strokeCap == StrokeCap::square)
+        {
+            strokeOutset *= math::SQRT2;
+        }
+        cullOutset += strokeOutset;
+    }
+    ViewportCuller viewportCuller(context, pixelBounds, m_matrix, cullOutset);
+
     // Count up how much temporary storage this function will need to reserve in CPU buffers.
     const RawPath& rawPath = m_pathRef->getRawPath();
-    size_t contourCount = rawPath.countMoveTos();
+    size_t contourCount = m_pathRef->getContourCount();
     if (contourCount == 0)
     {
         // The entire batch is empty.
@@ -540,7 +820,7 @@ MidpointFanPathDraw::MidpointFanPathDraw(PLSRenderContext* context,
     {
         maxStrokedCurvesBeforeChops += pathMaxLinesOrCurvesBeforeChops;
         maxRotations += pathMaxLinesOrCurvesAfterChops;
-        if (m_strokeJoin == StrokeJoin::round)
+        if (emittedStrokeJoin() == StrokeJoin::round)
         {
             // If the stroke has round joins, we also record the rotations between (pre-chopped)
             // joins in order to calculate how many vertices are in each round join.
@@ -579,10 +859,18 @@ MidpointFanPathDraw::MidpointFanPathDraw(PLSRenderContext* context,
     size_t contourIdx = 0;
     size_t curveIdx = 0;
     size_t rotationIdx = 0; // We measure rotations on both curves and round joins.
-    bool roundJoinStroked = isStroked() && m_strokeJoin == StrokeJoin::round;
-    wangs_formula::VectorXform vectorXform(m_matrix);
+    bool roundJoinStroked = isStroked() && emittedStrokeJoin() == StrokeJoin::round;
+    WangsFormulaCubicBatch wangsFormulaBatch(m_matrix, m_parametricSegmentCounts);
+    // Onscreen fills can reuse the segment counts cached on the path from a previous draw with the
+    // same 2x2 matrix (e.g., text that only moves).
+    const float* cachedCubicSegmentCountsP4 =
+        !isStroked() && !viewportCuller.enabled()
+            ? m_pathRef->getCubicParametricSegmentCountsP4(m_matrix)
+            : nullptr;
+    size_t cubicIdx = 0; // Index of the current cubic verb in the path.
     RawPath::Iter startOfContour = rawPath.begin();
     RawPath::Iter end = rawPath.end();
+    Convex180ChopQueue convex180Chops(end);
     int preChopVerbCount = 0; // Original number of lines and curves, before chopping.
     Vec2D endpointsSum{};
     bool closed = !isStroked();
@@ -629,6 +917,7 @@ MidpointFanPathDraw::MidpointFanPathDraw(PLSRenderContext* context,
         }
         assert(contourIdx < contourCount);
         m_contours[contourIdx++] = {
+            startOfContour,
             iter,
             lineCount,
             contourFirstCurveIdx,
@@ -643,6 +932,18 @@ MidpointFanPathDraw::MidpointFanPathDraw(PLSRenderContext* context,
             RIVE_DEBUG_CODE(0) // tessVertexCount
         };
         unpaddedCurveCount += curveIdx - contourFirstCurveIdx;
+        if (cachedCubicSegmentCountsP4 != nullptr)
+        {
+            // Pad with n^4 = 0, the same as wangsFormulaBatch.flush() would.
+            for (size_t i = curveIdx; i & 3; ++i)
+            {
+                m_parametricSegmentCounts[i] = 0;
+            }
+        }
+        else
+        {
+            wangsFormulaBatch.flush(curveIdx);
+        }
         contourFirstCurveIdx = curveIdx = math::round_up_to_multiple_of<4>(curveIdx);
         unpaddedRotationCount += rotationIdx - contourFirstRotationIdx;
         contourFirstRotationIdx = rotationIdx = math::round_up_to_multiple_of<4>(rotationIdx);
@@ -660,6 +961,25 @@ MidpointFanPathDraw::MidpointFanPathDraw(PLSRenderContext* context,
                     finishAndAppendContour(iter);
                     startOfContour = iter;
                 }
+                if (viewportCuller.enabled())
+                {
+                    RawPath::Iter lastVerbInContour = iter;
+                    RawPath::Iter nextContour = iter;
+                    for (++nextContour; nextContour != end && nextContour.verb() != PathVerb::move;
+                         ++nextContour)
+                    {
+                        lastVerbInContour = nextContour;
+                    }
+                    const Vec2D* pts = iter.rawPtsPtr();
+                    if (viewportCuller.isOffscreen(pts, nextContour.rawPtsPtr() - pts))
+                    {
+                        // Skip the entire contour. Pointing startOfContour at the next move
+                        // ensures the culled contour never gets appended.
+                        iter = lastVerbInContour;
+                        startOfContour = nextContour;
+                        break;
+                    }
+                }
                 preChopVerbCount = 0;
                 endpointsSum = {0, 0};
                 closed = !isStroked();
@@ -732,7 +1052,7 @@ MidpointFanPathDraw::MidpointFanPathDraw(PLSRenderContext* context,
                 // parametric/polar sorter.
                 float t[2];
                 bool areCusps;
-                uint8_t numChops = pathutils::FindCubicConvex180Chops(p, t, &areCusps);
+                uint8_t numChops = convex180Chops.next(iter, t, &areCusps);
                 uint8_t chopKey = chop_key(areCusps, numChops);
                 m_numChops.push_back(chopKey);
                 Vec2D localChopBuffer[16];
@@ -769,12 +1089,14 @@ MidpointFanPathDraw::MidpointFanPathDraw(PLSRenderContext* context,
                 for (const Vec2D* end = p + numChops * 3 + 3; p != end;
                      p += 3, ++curveIdx, ++rotationIdx)
                 {
-                    float n4 = wangs_formula::cubic_pow4(p, kParametricPrecision, vectorXform);
                     // Record n^4 for now. This will get resolved later.
                     assert(curveIdx < maxPaddedCurves);
-                    RIVE_INLINE_MEMCPY(m_parametricSegmentCounts + curveIdx, &n4, sizeof(uint32_t));
+                    wangsFormulaBatch.push(p, curveIdx);
                     assert(rotationIdx < maxPaddedRotations);
-                    find_cubic_tangents(p, m_tangentPairs[rotationIdx].data());
+                    if (!m_hairline) // Hairlines always get 1 polar segment.
+                    {
+                        find_cubic_tangents(p, m_tangentPairs[rotationIdx].data());
+                    }
                 }
                 break;
             }
@@ -783,10 +1105,27 @@ MidpointFanPathDraw::MidpointFanPathDraw(PLSRenderContext* context,
                 const Vec2D* p = iter.cubicPts();
                 ++preChopVerbCount;
                 endpointsSum += p[3];
-                float n4 = wangs_formula::cubic_pow4(p, kParametricPrecision, vectorXform);
+                if (viewportCuller.enabled() && viewportCuller.isOffscreen(p, 4))
+                {
+                    // The region between an offscreen cubic and its chord is also offscreen.
+                    // Tessellate it with a single segment by evaluating Wang's formula on a
+                    // degenerate (flat) cubic.
+                    const Vec2D flat[4] = {p[0], p[0], p[0], p[0]};
+                    assert(curveIdx < maxPaddedCurves);
+                    wangsFormulaBatch.push(flat, curveIdx++);
+                    break;
+                }
+                if (cachedCubicSegmentCountsP4 != nullptr)
+                {
+                    assert(curveIdx < maxPaddedCurves);
+                    RIVE_INLINE_MEMCPY(m_parametricSegmentCounts + curveIdx++,
+                                       cachedCubicSegmentCountsP4 + cubicIdx++,
+                                       sizeof(float));
+                    break;
+                }
                 // Record n^4 for now. This will get resolved later.
                 assert(curveIdx < maxPaddedCurves);
-                RIVE_INLINE_MEMCPY(m_parametricSegmentCounts + curveIdx++, &n4, sizeof(uint32_t));
+                wangsFormulaBatch.push(p, curveIdx++);
                 break;
             }
         }
@@ -795,8 +1134,9 @@ MidpointFanPathDraw::MidpointFanPathDraw(PLSRenderContext* context,
     {
         finishAndAppendContour(end);
     }
-    assert(contourIdx == contourCount);
-    assert(contourCount > 0);
+    assert(contourIdx <= contourCount);
+    assert(contourIdx == contourCount || viewportCuller.enabled());
+    contourCount = contourIdx; // Some contours may have been culled.
     assert(curveIdx <= maxPaddedCurves);
     assert(rotationIdx <= maxPaddedRotations);
     assert(curveIdx % 4 == 0);    // Because we write parametric segment counts in batches of 4.
@@ -814,6 +1154,11 @@ MidpointFanPathDraw::MidpointFanPathDraw(PLSRenderContext* context,
                                                                     rotationIdx);
     }
     context->parametricSegmentCountsAllocator().rewindLastAllocation(maxPaddedCurves - curveIdx);
+    if (contourCount == 0)
+    {
+        // Every contour in the path was offscreen.
+        return;
+    }
 
     // Iteration pass 2: Finish calculating the numbers of tessellation segments in each contour,
     // using SIMD.
@@ -857,6 +1202,14 @@ MidpointFanPathDraw::MidpointFanPathDraw(PLSRenderContext* context,
                 pathutils::CalcPolarSegmentsPerRadian<kPolarPrecision>(r_);
             for (j = contour->firstRotationIdx; j < contour->endRotationIdx; j += 4)
             {
+                if (m_hairline)
+                {
+                    // Hairlines didn't record tangents. Every curve gets a single polar segment.
+                    assert(j + 4 <= rotationIdx);
+                    simd::store(m_polarSegmentCounts + j, uint4(1));
+                    mergedTessVertexSums4 += 1;
+                    continue;
+                }
                 // Measure the rotations of curves in batches of 4.
                 assert(j + 4 <= rotationIdx);
                 auto [tx0, ty0, tx1, ty1] = simd::load4x4f(&m_tangentPairs[j][0].x);
@@ -893,7 +1246,7 @@ MidpointFanPathDraw::MidpointFanPathDraw(PLSRenderContext* context,
             }
 
             // Count joins.
-            if (m_strokeJoin == StrokeJoin::round)
+            if (emittedStrokeJoin() == StrokeJoin::round)
             {
                 // Round joins share their beginning and ending vertices with the curve on
                 // either side. Therefore, the number of vertices we need to allocate for a
@@ -1000,12 +1353,11 @@ MidpointFanPathDraw::MidpointFanPathDraw(PLSRenderContext* context,
 
 void MidpointFanPathDraw::onPushToRenderContext(PLSRenderContext::LogicalFlush* flush)
 {
-    const RawPath& rawPath = m_pathRef->getRawPath();
-    RawPath::Iter startOfContour = rawPath.begin();
     for (size_t i = 0; i < m_resourceCounts.contourCount; ++i)
     {
         // Push a contour and curve records.
         const ContourInfo& contour = m_contours[i];
+        const RawPath::Iter startOfContour = contour.startOfContour;
         assert(startOfContour.verb() == PathVerb::move);
         assert(isStroked() || contour.closed); // Fills are always closed.
         RIVE_DEBUG_CODE(m_pendingStrokeJoinCount = isStroked() ? contour.strokeJoinCount : 0;)
@@ -1021,7 +1373,7 @@ void MidpointFanPathDraw::onPushToRenderContext(PLSRenderContext::LogicalFlush*
         uint32_t emulatedCapAsJoinFlags = 0;
         if (isStroked())
         {
-            joinTypeFlags = join_type_flags(m_strokeJoin);
+            joinTypeFlags = join_type_flags(emittedStrokeJoin());
             roundJoinStroked = joinTypeFlags == 0;
             if (contour.strokeCapSegmentCount != 0)
             {
@@ -1295,7 +1647,6 @@ void MidpointFanPathDraw::onPushToRenderContext(PLSRenderContext::LogicalFlush*
 
         assert(m_pendingStrokeJoinCount == 0);
         assert(m_pendingStrokeCapCount == 0);
-        startOfContour = contour.endOfContour;
     }
 
     // Make sure we only pushed the amount of data we reserved.
@@ -1337,21 +1688,256 @@ InteriorTriangulationDraw::InteriorTriangulationDraw(PLSRenderContext* context,
                 std::move(path),
                 fillRule,
                 paint,
+                false,
                 Type::interiorTriangulationPath,
                 context->frameInterlockMode())
 {
     assert(!isStroked());
     assert(m_strokeRadius == 0);
-    processPath(PathOp::countDataAndTriangulate,
-                &context->perFrameAllocator(),
-                scratchPath,
-                triangulatorAxis,
-                nullptr);
+    assert(triangulatorAxis != TriangulatorAxis::dontCare);
+    auto direction = triangulatorAxis == TriangulatorAxis::horizontal
+                         ? GrTriangulator::Comparator::Direction::kHorizontal
+                         : GrTriangulator::Comparator::Direction::kVertical;
+    bool isDepthStencil = context->frameInterlockMode() == pls::InterlockMode::depthStencil;
+    auto groutTriangles = isDepthStencil ? GrInnerFanTriangulator::GroutTriangles::ignore
+                                         : GrInnerFanTriangulator::GroutTriangles::collect;
+
+    if (isDepthStencil)
+    {
+        flattenPath(context, scratchPath);
+    }
+    else
+    {
+        processPath(PathOp::countDataAndLinearize, context, scratchPath, nullptr);
+    }
+
+    if (tryConvexFan(context, *scratchPath))
+    {
+        return;
+    }
+    m_triangulatedPointCount = scratchPath->points().size();
+
+    // Triangulation only needs the linearized path, the matrix, and the fill rule, so unless the
+    // frame asks otherwise, it runs on a worker thread while the rest of the frame gets built up.
+    // The LogicalFlush waits on it before laying out resources.
+    if (!context->frameDescriptor().synchronousInteriorTriangulation)
+    {
+        auto job = std::make_unique<InteriorTriangulationJob>(m_matrix,
+                                                              direction,
+                                                              m_fillRule,
+                                                              groutTriangles);
+        *job->path() = *scratchPath;
+        m_triangulationJob = context->runInteriorTriangulationJob(std::move(job));
+        if (!m_isFlattenedTriangulation) // Flattened triangulations don't have grout.
+        {
+            reserveRoomForPendingTriangulation(context, paint, scratchPath->points().size());
+        }
+        return;
+    }
+
+    bool adaptive = context->frameDescriptor().adaptiveInteriorTriangulation;
+    auto startTime =
+        adaptive ? std::chrono::steady_clock::now() : std::chrono::steady_clock::time_point();
+    m_triangulator = context->make<GrInnerFanTriangulator>(*scratchPath,
+                                                           m_matrix,
+                                                           direction,
+                                                           m_fillRule,
+                                                           &context->perFrameAllocator(),
+                                                           groutTriangles);
+    if (adaptive)
+    {
+        auto elapsed = std::chrono::steady_clock::now() - startTime;
+        context->recordInteriorTriangulationTime(std::chrono::duration<double>(elapsed).count(),
+                                                 m_triangulatedPointCount);
+    }
+    countTriangulationResources();
+}
+
+void InteriorTriangulationDraw::reserveRoomForPendingTriangulation(PLSRenderContext* context,
+                                                                   const PLSPaint* paint,
+                                                                   size_t innerPolygonPointCount)
+{
+    // Grout triangles come from the triangulator shortening an edge to a vertex, which rarely
+    // happens more than once per point in the inner polygon, so reserve one patch per point. That
+    // way the LogicalFlush can reject us if the tessellation texture is too full, instead of
+    // overflowing once we resolve.
+    m_countsWithoutReservation = m_resourceCounts;
+    countGroutPatches(innerPolygonPointCount);
+
+    // GrTriangulator doesn't give a hard bound on grout, though. Also reserve room for a midpoint
+    // fan of the same path, which can always be drawn instead.
+    m_midpointFanFallback = context->make<MidpointFanPathDraw>(context,
+                                                               m_pixelBounds,
+                                                               m_matrix,
+                                                               ref_rcp(m_pathRef),
+                                                               m_fillRule,
+                                                               paint,
+                                                               false);
+    const ResourceCounters& fallbackCounts = m_midpointFanFallback->resourceCounts();
+    size_t tessVertexCount = std::max(m_resourceCounts.outerCubicTessVertexCount,
+                                      fallbackCounts.midpointFanTessVertexCount);
+    m_resourceCounts = simd::max(m_resourceCounts.toVec(), fallbackCounts.toVec());
+    // Either draw's patches go in the same tessellation texture, so only reserve the larger of the
+    // two.
+    m_resourceCounts.outerCubicTessVertexCount = tessVertexCount;
+    m_resourceCounts.midpointFanTessVertexCount = 0;
+}
+
+void InteriorTriangulationDraw::resolvePendingTriangulation(PLSRenderContext* context)
+{
+    assert(m_triangulationJob != nullptr);
+    assert(m_triangulator == nullptr);
+    m_triangulator = m_triangulationJob->wait();
+    if (context->frameDescriptor().adaptiveInteriorTriangulation)
+    {
+        context->recordInteriorTriangulationTime(m_triangulationJob->secondsElapsed(),
+                                                 m_triangulatedPointCount);
+    }
+    m_triangulationJob = nullptr;
+    countTriangulationResources();
+}
+
+bool InteriorTriangulationDraw::tryConvexFan(PLSRenderContext* context,
+                                             const RawPath& innerPolygon)
+{
+    // The linearized path has no closes, so one move means one contour.
+    const auto verbs = innerPolygon.verbs();
+    for (size_t i = 1; i < verbs.size(); ++i)
+    {
+        if (verbs[i] == PathVerb::move)
+        {
+            return false;
+        }
+    }
+    const auto pts = innerPolygon.points();
+    size_t count = pts.size();
+    if (count > 1 && pts[count - 1] == pts[0])
+    {
+        --count; // Drop the explicit return to the start point.
+    }
+    float signedArea;
+    if (count < 3 || !pathutils::IsConvexPolygon(pts.data(), count, &signedArea))
+    {
+        return false;
+    }
+    if (signedArea != 0)
+    {
+        auto* fanPoints = reinterpret_cast<Vec2D*>(
+            context->perFrameAllocator().alloc<alignof(Vec2D)>(count * sizeof(Vec2D)));
+        memcpy(fanPoints, pts.data(), count * sizeof(Vec2D));
+        m_convexFanPoints = fanPoints;
+        m_convexFanPointCount = static_cast<uint32_t>(count);
+        // A positive signed area winds clockwise, which pls counts as a weight of +1. (The same
+        // weight GrTriangulator would assign.)
+        m_convexFanWeight = signedArea > 0 ? 1 : -1;
+        m_resourceCounts.maxTriangleVertexCount = count;
+        m_resourceCounts.maxTriangleIndexCount = (count - 2) * 3;
+    }
+    return true;
+}
+
+size_t InteriorTriangulationDraw::writeInteriorTriangles(
+    WriteOnlyMappedMemory<TriangleVertex>* vertexBufferRing,
+    WriteOnlyMappedMemory<uint32_t>* indexBufferRing,
+    uint16_t pathID) const
+{
+    assert(!hasPendingTriangulation());
+    if (m_triangulator != nullptr)
+    {
+        return m_triangulator->polysToTriangles(vertexBufferRing, indexBufferRing, pathID);
+    }
+    if (m_convexFanPointCount == 0)
+    {
+        return 0;
+    }
+    uint32_t baseVertex = static_cast<uint32_t>(vertexBufferRing->elementsWritten());
+    for (uint32_t i = 0; i < m_convexFanPointCount; ++i)
+    {
+        vertexBufferRing->emplace_back(m_convexFanPoints[i], m_convexFanWeight, pathID);
+    }
+    // Like GrTriangulator, emit triangles that turn clockwise in local space, and reverse them if
+    // the matrix mirrors the path.
+    bool isMirrored = m_matrix[0] * m_matrix[3] - m_matrix[2] * m_matrix[1] < 0;
+    bool reverseTriangles = (m_convexFanWeight < 0) != isMirrored;
+    for (uint32_t i = 1; i + 1 < m_convexFanPointCount; ++i)
+    {
+        uint32_t b = baseVertex + i, c = baseVertex + i + 1;
+        if (reverseTriangles)
+        {
+            std::swap(b, c);
+        }
+        indexBufferRing->emplace_back(baseVertex);
+        indexBufferRing->emplace_back(b);
+        indexBufferRing->emplace_back(c);
+    }
+    return (m_convexFanPointCount - 2) * 3;
+}
+
+void InteriorTriangulationDraw::countTriangulationResources()
+{
+    assert(m_triangulator != nullptr);
+    size_t reservedTessVertexCount = m_resourceCounts.outerCubicTessVertexCount;
+    if (m_midpointFanFallback != nullptr)
+    {
+        m_resourceCounts = m_countsWithoutReservation;
+    }
+    // We also draw each "grout" triangle using an outerCubic patch.
+    size_t groutCount = m_triangulator->groutList().count();
+    assert(!m_isFlattenedTriangulation || groutCount == 0);
+    countGroutPatches(groutCount);
+    m_resourceCounts.maxTriangleVertexCount = m_triangulator->maxVertexCount();
+    m_resourceCounts.maxTriangleIndexCount = m_triangulator->maxIndexCount();
+    if (m_midpointFanFallback != nullptr)
+    {
+        m_overranReservation = m_resourceCounts.outerCubicTessVertexCount > reservedTessVertexCount;
+        if (!m_overranReservation)
+        {
+            m_midpointFanFallback->releaseRefs();
+            m_midpointFanFallback = nullptr;
+        }
+    }
+}
+
+PLSDrawUniquePtr InteriorTriangulationDraw::takeMidpointFanFallback()
+{
+    assert(m_overranReservation);
+    assert(m_midpointFanFallback != nullptr);
+    m_midpointFanFallback->inheritFlushState(*this);
+    PLSDrawUniquePtr fallback(m_midpointFanFallback);
+    m_midpointFanFallback = nullptr;
+    return fallback;
+}
+
+void InteriorTriangulationDraw::releaseRefs()
+{
+    PLSPathDraw::releaseRefs();
+    if (m_midpointFanFallback != nullptr)
+    {
+        m_midpointFanFallback->releaseRefs();
+    }
+}
+
+void InteriorTriangulationDraw::countGroutPatches(size_t groutCount)
+{
+    size_t tessVertexCount = groutCount * kOuterCurvePatchSegmentSpan;
+    if (m_contourDirections == pls::ContourDirections::reverseAndForward)
+    {
+        tessVertexCount *= 2;
+    }
+    m_resourceCounts.maxTessellatedSegmentCount += groutCount;
+    m_resourceCounts.outerCubicTessVertexCount += tessVertexCount;
 }
 
 void InteriorTriangulationDraw::onPushToRenderContext(PLSRenderContext::LogicalFlush* flush)
 {
-    processPath(PathOp::submitOuterCubics, nullptr, nullptr, TriangulatorAxis::dontCare, flush);
+    assert(!hasPendingTriangulation());
+    if (m_isFlattenedTriangulation)
+    {
+        assert(flush->desc().interlockMode == pls::InterlockMode::depthStencil);
+        flush->pushInteriorTriangulation(this);
+        return;
+    }
+    processPath(PathOp::submitOuterCubics, nullptr, nullptr, flush);
     if (flush->desc().interlockMode == pls::InterlockMode::atomics)
     {
         // We need a barrier between the outer cubics and interior triangles in atomic mode.
@@ -1361,22 +1947,105 @@ void InteriorTriangulationDraw::onPushToRenderContext(PLSRenderContext::LogicalF
 }
 
 void InteriorTriangulationDraw::processPath(PathOp op,
-                                            TrivialBlockAllocator* allocator,
-                                            RawPath* scratchPath,
-                                            TriangulatorAxis triangulatorAxis,
+                                            PLSRenderContext* context,
+                                            RawPath* innerPolygon,
                                             PLSRenderContext::LogicalFlush* flush)
 {
-    Vec2D chops[kMaxCurveSubdivisions * 3 + 1];
     const RawPath& rawPath = m_pathRef->getRawPath();
     assert(!rawPath.empty());
     wangs_formula::VectorXform vectorXform(m_matrix);
     size_t patchCount = 0;
     size_t contourCount = 0;
+    size_t cubicCount = 0;
     Vec2D p0 = {0, 0};
-    if (op == PathOp::countDataAndTriangulate)
+    TrivialBlockAllocator* allocator = nullptr;
+    bool cullOffscreenCubics = false;
+    std::optional<ViewportCuller> viewportCuller;
+    if (op == PathOp::countDataAndLinearize)
     {
-        scratchPath->rewind();
+        allocator = &context->perFrameAllocator();
+        viewportCuller.emplace(context, m_pixelBounds, m_matrix, 1.f /*AA ramp*/);
+        cullOffscreenCubics = viewportCuller->enabled();
+        innerPolygon->rewind();
+        // The verb count is an upper bound on the number of cubics.
+        assert(m_subdividedCubics == nullptr);
+        m_subdividedCubics = reinterpret_cast<SubdividedCubic*>(
+            allocator->alloc<alignof(SubdividedCubic)>(rawPath.verbs().size() *
+                                                       sizeof(SubdividedCubic)));
     }
+    // At extreme zoom, a cubic can need more than kMaxCurveSubdivisions patches. Clamping would
+    // visibly facet it, so instead split it in half, recursively, until each piece fits. Pieces
+    // that fall offscreen only get a single patch, which keeps the cost proportional to the
+    // curve's visible length.
+    auto subdivideHugeCubic = [&](const Vec2D pts[4]) {
+        struct Piece
+        {
+            std::array<Vec2D, 4> pts;
+            int depth;
+        };
+        // Each split pops one piece and pushes two, so the stack never exceeds depth + 1.
+        Piece stack[kMaxHugeCubicSplitDepth + 1];
+        int stackSize = 0;
+        stack[stackSize++] = {{pts[0], pts[1], pts[2], pts[3]}, 0};
+        // Splitting stops at kMaxHugeCubicSplitDepth, so there are never more leaves than this.
+        struct Leaf
+        {
+            std::array<Vec2D, 4> pts;
+            uint32_t numSubdivisions;
+        };
+        Leaf leaves[1 << kMaxHugeCubicSplitDepth];
+        size_t leafCount = 0;
+        uint32_t numSubdivisions = 0;
+        while (stackSize > 0)
+        {
+            const Piece piece = stack[--stackSize];
+            const Vec2D* p = piece.pts.data();
+            float n = cullOffscreenCubics && viewportCuller->isOffscreen(p, 4)
+                          ? 1
+                          : FindUnclampedSubdivisionCount(p, vectorXform);
+            if (n > static_cast<float>(kMaxCurveSubdivisions) &&
+                piece.depth < kMaxHugeCubicSplitDepth)
+            {
+                Vec2D halves[7];
+                pathutils::ChopCubicAt(p, halves, .5f);
+                // Push the second half first so the pieces come out in order.
+                stack[stackSize++] = {{halves[3], halves[4], halves[5], halves[6]},
+                                      piece.depth + 1};
+                stack[stackSize++] = {{halves[0], halves[1], halves[2], halves[3]},
+                                      piece.depth + 1};
+                assert(stackSize <= kMaxHugeCubicSplitDepth + 1);
+                continue;
+            }
+            auto pieceSubdivisions = static_cast<uint32_t>(
+                std::clamp<float>(n, 1, static_cast<float>(kMaxCurveSubdivisions)));
+            assert(leafCount < (1 << kMaxHugeCubicSplitDepth));
+            leaves[leafCount++] = {piece.pts, pieceSubdivisions};
+            numSubdivisions += pieceSubdivisions;
+        }
+        // Now that the total is known, chop every leaf into one chain from the per-frame allocator.
+        auto* chain = reinterpret_cast<Vec2D*>(
+            allocator->alloc<alignof(Vec2D)>((numSubdivisions * 3 + 1) * sizeof(Vec2D)));
+        chain[0] = pts[0];
+        Vec2D* chainEnd = chain + 1; // The chops share their first point with the end of the chain.
+        for (size_t i = 0; i < leafCount; ++i)
+        {
+            const Leaf& leaf = leaves[i];
+            if (leaf.numSubdivisions == 1)
+            {
+                memcpy(chainEnd, leaf.pts.data() + 1, sizeof(Vec2D) * 3);
+            }
+            else
+            {
+                pathutils::ChopCubicAt(leaf.pts.data(),
+                                       chainEnd - 1,
+                                       nullptr,
+                                       static_cast<int>(leaf.numSubdivisions - 1));
+            }
+            chainEnd += leaf.numSubdivisions * 3;
+        }
+        assert(chainEnd == chain + numSubdivisions * 3 + 1);
+        return SubdividedCubic{chain, numSubdivisions};
+    };
     for (const auto [verb, pts] : rawPath)
     {
         switch (verb)
@@ -1395,9 +2064,9 @@ void InteriorTriangulationDraw::processPath(PathOp op,
                     }
                     ++patchCount;
                 }
-                if (op == PathOp::countDataAndTriangulate)
+                if (op == PathOp::countDataAndLinearize)
                 {
-                    scratchPath->move(pts[0]);
+                    innerPolygon->move(pts[0]);
                 }
                 else
                 {
@@ -1407,9 +2076,9 @@ void InteriorTriangulationDraw::processPath(PathOp op,
                 ++contourCount;
                 break;
             case PathVerb::line:
-                if (op == PathOp::countDataAndTriangulate)
+                if (op == PathOp::countDataAndLinearize)
                 {
-                    scratchPath->line(pts[1]);
+                    innerPolygon->line(pts[1]);
                 }
                 else
                 {
@@ -1426,48 +2095,59 @@ void InteriorTriangulationDraw::processPath(PathOp op,
                 RIVE_UNREACHABLE();
             case PathVerb::cubic:
             {
-                size_t numSubdivisions = FindSubdivisionCount(pts, vectorXform);
-                if (numSubdivisions == 1)
+                SubdividedCubic& subdividedCubic = m_subdividedCubics[cubicCount++];
+                if (op == PathOp::countDataAndLinearize)
                 {
-                    if (op == PathOp::countDataAndTriangulate)
+                    // Offscreen cubics only need a single (imprecise) outerCurve patch. The
+                    // region between the curve and its chord is offscreen too.
+                    float unclampedSubdivisionCount =
+                        cullOffscreenCubics && viewportCuller->isOffscreen(pts, 4)
+                            ? 1
+                            : FindUnclampedSubdivisionCount(pts, vectorXform);
+                    if (unclampedSubdivisionCount > static_cast<float>(kMaxCurveSubdivisions))
                     {
-                        scratchPath->line(pts[3]);
+                        subdividedCubic = subdivideHugeCubic(pts);
                     }
                     else
                     {
-                        flush->pushCubic(pts,
-                                         {0, 0},
-                                         CULL_EXCESS_TESSELLATION_SEGMENTS_CONTOUR_FLAG,
-                                         kPatchSegmentCountExcludingJoin,
-                                         1,
-                                         kJoinSegmentCount);
-                    }
-                }
-                else
-                {
-                    // Passing nullptr for the 'tValues' causes it to chop the cubic uniformly
-                    // in T.
-                    pathutils::ChopCubicAt(pts, chops, nullptr, numSubdivisions - 1);
-                    const Vec2D* chop = chops;
-                    for (size_t i = 0; i < numSubdivisions; ++i)
-                    {
-                        if (op == PathOp::countDataAndTriangulate)
+                        size_t numSubdivisions =
+                            static_cast<size_t>(std::max(unclampedSubdivisionCount, 1.f));
+                        if (numSubdivisions == 1)
                         {
-                            scratchPath->line(chop[3]);
+                            subdividedCubic.pts = pts;
                         }
                         else
                         {
-                            flush->pushCubic(chop,
-                                             {0, 0},
-                                             CULL_EXCESS_TESSELLATION_SEGMENTS_CONTOUR_FLAG,
-                                             kPatchSegmentCountExcludingJoin,
-                                             1,
-                                             kJoinSegmentCount);
+                            // Passing nullptr for the 'tValues' causes it to chop the cubic
+                            // uniformly in T.
+                            auto* chops = reinterpret_cast<Vec2D*>(
+                                allocator->alloc<alignof(Vec2D)>((numSubdivisions * 3 + 1) *
+                                                                 sizeof(Vec2D)));
+                            pathutils::ChopCubicAt(pts, chops, nullptr, numSubdivisions - 1);
+                            subdividedCubic.pts = chops;
                         }
-                        chop += 3;
+                        subdividedCubic.numSubdivisions = static_cast<uint32_t>(numSubdivisions);
+                    }
+                }
+                const Vec2D* chop = subdividedCubic.pts;
+                for (size_t i = 0; i < subdividedCubic.numSubdivisions; ++i)
+                {
+                    if (op == PathOp::countDataAndLinearize)
+                    {
+                        innerPolygon->line(chop[3]);
+                    }
+                    else
+                    {
+                        flush->pushCubic(chop,
+                                         {0, 0},
+                                         CULL_EXCESS_TESSELLATION_SEGMENTS_CONTOUR_FLAG,
+                                         kPatchSegmentCountExcludingJoin,
+                                         1,
+                                         kJoinSegmentCount);
                     }
+                    chop += 3;
                 }
-                patchCount += numSubdivisions;
+                patchCount += subdividedCubic.numSubdivisions;
                 break;
             }
             case PathVerb::close:
@@ -1489,21 +2169,10 @@ void InteriorTriangulationDraw::processPath(PathOp op,
         ++patchCount;
     }
 
-    if (op == PathOp::countDataAndTriangulate)
+    if (op == PathOp::countDataAndLinearize)
     {
-        assert(m_triangulator == nullptr);
-        assert(triangulatorAxis != TriangulatorAxis::dontCare);
-        m_triangulator = allocator->make<GrInnerFanTriangulator>(
-            *scratchPath,
-            m_matrix,
-            triangulatorAxis == TriangulatorAxis::horizontal
-                ? GrTriangulator::Comparator::Direction::kHorizontal
-                : GrTriangulator::Comparator::Direction::kVertical,
-            m_fillRule,
-            allocator);
-        // We also draw each "grout" triangle using an outerCubic patch.
-        patchCount += m_triangulator->groutList().count();
-
+        // The grout patches get added once the triangulation is done. (See
+        // countTriangulationResources().)
         m_resourceCounts.pathCount = 1;
         m_resourceCounts.contourCount = contourCount;
         // maxTessellatedSegmentCount does not get doubled when we emit both forward and mirrored
@@ -1515,11 +2184,9 @@ void InteriorTriangulationDraw::processPath(PathOp op,
             m_contourDirections == pls::ContourDirections::reverseAndForward
                 ? patchCount * kOuterCurvePatchSegmentSpan * 2
                 : patchCount * kOuterCurvePatchSegmentSpan;
-        m_resourceCounts.maxTriangleVertexCount = m_triangulator->maxVertexCount();
     }
-    else
+    else if (m_triangulator != nullptr) // Convex fans don't have grout.
     {
-        assert(m_triangulator != nullptr);
         // Submit grout triangles, retrofitted into outerCubic patches.
         for (auto* node = m_triangulator->groutList().head(); node; node = node->fNext)
         {
@@ -1541,6 +2208,55 @@ void InteriorTriangulationDraw::processPath(PathOp op,
     }
 }
 
+void InteriorTriangulationDraw::flattenPath(PLSRenderContext* context, RawPath* flattenedPath)
+{
+    const RawPath& rawPath = m_pathRef->getRawPath();
+    assert(!rawPath.empty());
+    wangs_formula::VectorXform vectorXform(m_matrix);
+    ViewportCuller viewportCuller(context, m_pixelBounds, m_matrix, 1.f /*AA ramp*/);
+    flattenedPath->rewind();
+    for (const auto [verb, pts] : rawPath)
+    {
+        switch (verb)
+        {
+            case PathVerb::move:
+                flattenedPath->move(pts[0]);
+                break;
+            case PathVerb::line:
+                flattenedPath->line(pts[1]);
+                break;
+            case PathVerb::quad:
+                RIVE_UNREACHABLE();
+            case PathVerb::cubic:
+            {
+                // Offscreen cubics can be replaced by their chord. The region between the curve
+                // and its chord is offscreen too.
+                uint32_t segmentCount = 1;
+                if (!viewportCuller.enabled() || !viewportCuller.isOffscreen(pts, 4))
+                {
+                    float n = ceilf(wangs_formula::cubic(pts, kParametricPrecision, vectorXform));
+                    segmentCount = static_cast<uint32_t>(
+                        std::clamp<float>(n, 1, static_cast<float>(kMaxParametricSegments)));
+                }
+                float dT = 1.f / segmentCount;
+                for (uint32_t i = 1; i < segmentCount; ++i)
+                {
+                    flattenedPath->line(pathutils::EvalCubicAt(pts, i * dT));
+                }
+                flattenedPath->line(pts[3]);
+                break;
+            }
+            case PathVerb::close:
+                break;
+        }
+    }
+
+    m_isFlattenedTriangulation = true;
+
+    // The path still needs a record in the path buffer, but has no contours or patches.
+    m_resourceCounts.pathCount = 1;
+}
+
 ImageRectDraw::ImageRectDraw(PLSRenderContext* context,
                              IAABB pixelBounds,
                              const Mat2D& matrix,
@@ -1574,6 +2290,7 @@ ImageMeshDraw::ImageMeshDraw(IAABB pixelBounds,
     m_vertexBufferRef(vertexBuffer.release()),
     m_uvBufferRef(uvBuffer.release()),
     m_indexBufferRef(indexBuffer.release()),
+    m_streamedMeshRef(nullptr),
     m_indexCount(indexCount),
     m_opacity(opacity)
 {
@@ -1583,6 +2300,26 @@ ImageMeshDraw::ImageMeshDraw(IAABB pixelBounds,
     m_resourceCounts.imageDrawCount = 1;
 }
 
+ImageMeshDraw::ImageMeshDraw(IAABB pixelBounds,
+                             const Mat2D& matrix,
+                             BlendMode blendMode,
+                             rcp<const PLSTexture> imageTexture,
+                             rcp<const StreamedImageMesh> streamedMesh,
+                             float opacity) :
+    PLSDraw(pixelBounds, matrix, blendMode, std::move(imageTexture), Type::imageMesh),
+    m_vertexBufferRef(nullptr),
+    m_uvBufferRef(nullptr),
+    m_indexBufferRef(nullptr),
+    m_streamedMeshRef(streamedMesh.release()),
+    m_indexCount(m_streamedMeshRef->indexCount()),
+    m_opacity(opacity)
+{
+    assert(m_streamedMeshRef != nullptr);
+    m_resourceCounts.imageDrawCount = 1;
+    m_resourceCounts.streamedMeshVertexCount = m_streamedMeshRef->vertexCount();
+    m_resourceCounts.streamedMeshIndexCount = m_indexCount;
+}
+
 void ImageMeshDraw::pushToRenderContext(PLSRenderContext::LogicalFlush* flush)
 {
     flush->pushImageMesh(this);
@@ -1591,9 +2328,10 @@ void ImageMeshDraw::pushToRenderContext(PLSRenderContext::LogicalFlush* flush)
 void ImageMeshDraw::releaseRefs()
 {
     PLSDraw::releaseRefs();
-    m_vertexBufferRef->unref();
-    m_uvBufferRef->unref();
-    m_indexBufferRef->unref();
+    safe_unref(m_vertexBufferRef);
+    safe_unref(m_uvBufferRef);
+    safe_unref(m_indexBufferRef);
+    safe_unref(m_streamedMeshRef);
 }
 
 StencilClipReset::StencilClipReset(PLSRenderContext* context,
@@ -148,6 +148,12 @@ void PLSPaint::clipUpdate(uint32_t outerClipID)
     m_imageTexture.reset();
 }
 
+void PLSPaint::dash(const float intervals[], size_t count, float phase)
+{
+    m_dashIntervals.assign(intervals, intervals + count);
+    m_dashPhase = phase;
+}
+
 bool PLSPaint::getIsOpaque() const
 {
     switch (m_paintType)
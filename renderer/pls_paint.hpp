@@ -7,6 +7,7 @@
 #include "rive/pls/pls.hpp"
 #include "rive/renderer.hpp"
 #include <array>
+#include <vector>
 
 namespace rive::pls
 {
@@ -122,6 +123,9 @@ public:
     void shader(rcp<RenderShader> shader) override;
     void image(rcp<const PLSTexture>, float opacity);
     void clipUpdate(uint32_t outerClipID);
+    // Dashes strokes with alternating "on" and "off" arc lengths, beginning 'phase' units into the
+    // pattern. An odd number of intervals repeats twice. A count of 0 disables dashing.
+    void dash(const float intervals[], size_t count, float phase);
     void invalidateStroke() override {}
 
     PaintType getType() const { return m_paintType; }
@@ -135,6 +139,9 @@ public:
     StrokeJoin getJoin() const { return m_join; }
     StrokeCap getCap() const { return m_cap; }
     BlendMode getBlendMode() const { return m_blendMode; }
+    bool getIsDashed() const { return !m_dashIntervals.empty(); }
+    const std::vector<float>& getDashIntervals() const { return m_dashIntervals; }
+    float getDashPhase() const { return m_dashPhase; }
     pls::SimplePaintValue getSimpleValue() const { return m_simpleValue; }
     bool getIsOpaque() const;
 
@@ -148,5 +155,7 @@ private:
     StrokeCap m_cap = StrokeCap::butt;
     BlendMode m_blendMode = BlendMode::srcOver;
     bool m_stroked = false;
+    std::vector<float> m_dashIntervals;
+    float m_dashPhase = 0;
 };
 } // namespace rive::pls
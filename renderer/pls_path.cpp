@@ -7,6 +7,7 @@
 #include "eval_cubic.hpp"
 #include "rive/math/simd.hpp"
 #include "rive/math/wangs_formula.hpp"
+#include "rive/pls/pls.hpp"
 
 namespace rive::pls
 {
@@ -153,6 +154,46 @@ float PLSPath::getCoarseArea() const
     return m_coarseArea;
 }
 
+size_t PLSPath::getContourCount() const
+{
+    if (m_dirt & kContourCountDirt)
+    {
+        m_contourCount = m_rawPath.countMoveTos();
+        m_dirt &= ~kContourCountDirt;
+    }
+    return m_contourCount;
+}
+
+const float* PLSPath::getCubicParametricSegmentCountsP4(const Mat2D& matrix) const
+{
+    float matrix2x2[4] = {matrix.xx(), matrix.xy(), matrix.yx(), matrix.yy()};
+    if ((m_dirt & kCubicParametricSegmentCountsDirt) ||
+        memcmp(matrix2x2, m_cubicParametricSegmentCountsMatrix, sizeof(matrix2x2)) != 0)
+    {
+        // Just remember the 2x2 for now. If it's animating, caching would miss on every frame.
+        memcpy(m_cubicParametricSegmentCountsMatrix, matrix2x2, sizeof(matrix2x2));
+        m_hasCubicParametricSegmentCounts = false;
+        m_dirt &= ~kCubicParametricSegmentCountsDirt;
+        return nullptr;
+    }
+    if (!m_hasCubicParametricSegmentCounts)
+    {
+        // This is the second time in a row we've seen the same 2x2. Cache the counts.
+        wangs_formula::VectorXform vectorXform(matrix);
+        m_cubicParametricSegmentCountsP4.clear();
+        for (auto [verb, pts] : m_rawPath)
+        {
+            if (verb == PathVerb::cubic)
+            {
+                m_cubicParametricSegmentCountsP4.push_back(
+                    wangs_formula::cubic_pow4(pts, kParametricPrecision, vectorXform));
+            }
+        }
+        m_hasCubicParametricSegmentCounts = true;
+    }
+    return m_cubicParametricSegmentCountsP4.data();
+}
+
 uint64_t PLSPath::getRawPathMutationID() const
 {
     static std::atomic<uint64_t> uniqueIDCounter = 0;
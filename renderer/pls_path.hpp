@@ -6,6 +6,7 @@
 
 #include "rive/math/raw_path.hpp"
 #include "rive/renderer.hpp"
+#include <vector>
 
 namespace rive::pls
 {
@@ -28,6 +29,16 @@ public:
     void addRenderPath(RenderPath* path, const Mat2D& matrix) override;
 
     const RawPath& getRawPath() const { return m_rawPath; }
+
+    // Direct access to the RawPath, for callers that rebuild the entire path in place in order to
+    // recycle its memory. Invalidates everything cached about the path, so don't hold onto the
+    // pointer past the point where the path gets read.
+    RawPath* mutableRawPath()
+    {
+        assert(m_rawPathMutationLockCount == 0);
+        m_dirt = kAllDirt;
+        return &m_rawPath;
+    }
     FillRule getFillRule() const { return m_fillRule; }
 
     const AABB& getBounds() const;
@@ -36,6 +47,16 @@ public:
     constexpr static float kCoarseAreaTolerance = 8; // Linearize within 8px of the true curve.
     float getCoarseArea() const;
     uint64_t getRawPathMutationID() const;
+    size_t getContourCount() const;
+
+    // Returns Wang's formula, raised to the 4th power, for each cubic in the path (in path order)
+    // as seen through the 2x2 portion of 'matrix'. The results are cached until either the path or
+    // the 2x2 changes, so paths that get redrawn with only a different translation (e.g., text
+    // that scrolls or animates position) skip evaluating their curves again.
+    //
+    // Returns null the first time the path is seen with a given 2x2. Only a 2x2 that gets reused
+    // is worth caching; until then, the caller should evaluate the cubics itself (in batches).
+    const float* getCubicParametricSegmentCountsP4(const Mat2D& matrix) const;
 
 #ifdef DEBUG
     // Allows ref holders to guarantee the rawPath doesn't mutate during a specific time.
@@ -53,12 +74,18 @@ private:
     mutable AABB m_bounds;
     mutable float m_coarseArea;
     mutable uint64_t m_rawPathMutationID;
+    mutable size_t m_contourCount;
+    mutable std::vector<float> m_cubicParametricSegmentCountsP4;
+    mutable float m_cubicParametricSegmentCountsMatrix[4]; // [xx, xy, yx, yy]
+    mutable bool m_hasCubicParametricSegmentCounts = false;
 
     enum Dirt
     {
         kPathBoundsDirt = 1 << 0,
         kRawPathMutationIDDirt = 1 << 1,
         kPathCoarseAreaDirt = 1 << 2,
+        kContourCountDirt = 1 << 3,
+        kCubicParametricSegmentCountsDirt = 1 << 4,
         kAllDirt = ~0,
     };
 
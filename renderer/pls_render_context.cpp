@@ -5,13 +5,17 @@
 #include "rive/pls/pls_render_context.hpp"
 
 #include "gr_inner_fan_triangulator.hpp"
+#include "interior_triangulation_job.hpp"
 #include "intersection_board.hpp"
+#include "ktx2.hpp"
 #include "pls_paint.hpp"
 #include "rive/pls/pls_draw.hpp"
 #include "rive/pls/pls_image.hpp"
 #include "rive/pls/pls_render_context_impl.hpp"
 #include "shaders/constants.glsl"
+#include "worker_pool.hpp"
 
+#include <atomic>
 #include <string_view>
 
 namespace rive::pls
@@ -117,6 +121,79 @@ rcp<RenderImage> PLSRenderContext::decodeImage(Span<const uint8_t> encodedBytes)
     return texture != nullptr ? make_rcp<PLSImage>(std::move(texture)) : nullptr;
 }
 
+struct PLSRenderContext::ImageDecodeJob
+{
+    std::vector<uint8_t> encodedBytes;
+    pls::DecodedImage decodedImage;
+    bool succeeded = false;
+    std::atomic<bool> finished = false;
+};
+
+rcp<RenderImage> PLSRenderContext::decodeImageAsync(Span<const uint8_t> encodedBytes)
+{
+    if (IsKTX2(encodedBytes))
+    {
+        // Block-compressed images don't need decoding. Upload them immediately.
+        return decodeImage(encodedBytes);
+    }
+
+    if (m_imageDecodeWorkers == nullptr)
+    {
+        m_imageDecodeWorkers = std::make_unique<WorkerPool>();
+    }
+
+    auto image = make_rcp<PLSAsyncImage>();
+    auto job = std::make_shared<ImageDecodeJob>();
+    // The caller's bytes aren't guaranteed to outlive this call.
+    job->encodedBytes.assign(encodedBytes.begin(), encodedBytes.end());
+    m_pendingImageDecodes.push_back({image, job});
+
+    PLSRenderContextImpl* impl = m_impl.get();
+    m_imageDecodeWorkers->run([impl, job]() {
+        job->succeeded =
+            impl->decodeImagePixels(Span(job->encodedBytes.data(), job->encodedBytes.size()),
+                                    &job->decodedImage);
+        job->encodedBytes = {};
+        job->finished.store(true, std::memory_order_release);
+    });
+
+    return image;
+}
+
+InteriorTriangulationJob* PLSRenderContext::runInteriorTriangulationJob(
+    std::unique_ptr<InteriorTriangulationJob> job)
+{
+    assert(m_didBeginFrame);
+    if (m_interiorTriangulationWorkers == nullptr)
+    {
+        m_interiorTriangulationWorkers = std::make_unique<WorkerPool>();
+    }
+    InteriorTriangulationJob* jobPtr = job.get();
+    m_interiorTriangulationJobs.push_back(std::move(job));
+    m_interiorTriangulationWorkers->run([jobPtr]() { jobPtr->run(); });
+    return jobPtr;
+}
+
+void PLSRenderContext::resolveFinishedImageDecodes()
+{
+    auto end = std::remove_if(
+        m_pendingImageDecodes.begin(),
+        m_pendingImageDecodes.end(),
+        [this](PendingImageDecode& pending) {
+            if (!pending.job->finished.load(std::memory_order_acquire))
+            {
+                return false;
+            }
+            if (pending.job->succeeded)
+            {
+                pending.image->resolveTexture(
+                    m_impl->makeDecodedImageTexture(pending.job->decodedImage));
+            }
+            return true;
+        });
+    m_pendingImageDecodes.erase(end, m_pendingImageDecodes.end());
+}
+
 void PLSRenderContext::releaseResources()
 {
     assert(!m_didBeginFrame);
@@ -154,6 +231,7 @@ void PLSRenderContext::LogicalFlush::rewind()
     m_pendingComplexColorRampDraws.clear();
     m_clips.clear();
     m_plsDraws.clear();
+    m_pendingInteriorTriangulations.clear();
     m_combinedDrawBounds = {std::numeric_limits<int32_t>::max(),
                             std::numeric_limits<int32_t>::max(),
                             std::numeric_limits<int32_t>::min(),
@@ -187,6 +265,8 @@ void PLSRenderContext::LogicalFlush::rewind()
     m_currentZIndex = 0;
 
     RIVE_DEBUG_CODE(m_hasDoneLayout = false;)
+
+    RIVE_PLS_STATS_CODE(m_flushReason = LogicalFlushReason::requested;)
 }
 
 void PLSRenderContext::LogicalFlush::resetContainers()
@@ -232,13 +312,57 @@ void PLSRenderContext::beginFrame(const FrameDescriptor& frameDescriptor)
         m_frameInterlockMode = pls::InterlockMode::rasterOrdering;
     }
     m_frameShaderFeaturesMask = pls::ShaderFeaturesMaskFor(m_frameInterlockMode);
+    if (!m_pendingImageDecodes.empty())
+    {
+        resolveFinishedImageDecodes();
+    }
     if (m_logicalFlushes.empty())
     {
         m_logicalFlushes.emplace_back(new LogicalFlush(this));
     }
+    if (m_frameDescriptor.adaptiveInteriorTriangulation)
+    {
+        m_interiorTriangulationNanosPerPoint +=
+            (kInitialInteriorTriangulationNanosPerPoint - m_interiorTriangulationNanosPerPoint) *
+            (1 / kInteriorTriangulationDecayFrames);
+    }
+    ++m_frameCount;
+    RIVE_PLS_STATS_CODE(m_frameStats = FrameStats();)
+    RIVE_PLS_STATS_CODE(m_frameStats.frameNumber = m_frameCount;)
     RIVE_DEBUG_CODE(m_didBeginFrame = true);
 }
 
+bool PLSRenderContext::shouldTriangulateInterior(float pixelArea, size_t pointCount) const
+{
+    assert(m_didBeginFrame);
+    if (!m_frameDescriptor.adaptiveInteriorTriangulation)
+    {
+        return pixelArea > m_frameDescriptor.interiorTriangulationMinArea;
+    }
+    if (pixelArea <= kMinAdaptiveInteriorTriangulationArea)
+    {
+        return false;
+    }
+    float fanOverdrawNanos = pixelArea * m_frameDescriptor.fanOverdrawNanosPerPixel;
+    float triangulationNanos =
+        static_cast<float>(pointCount) * m_interiorTriangulationNanosPerPoint;
+    return fanOverdrawNanos > triangulationNanos;
+}
+
+void PLSRenderContext::recordInteriorTriangulationTime(double seconds, size_t pointCount)
+{
+    if (pointCount == 0)
+    {
+        return;
+    }
+    float nanosPerPoint = static_cast<float>(seconds * 1e9 / static_cast<double>(pointCount));
+    // Exponential moving average, so one slow path (e.g., a cache miss or a context switch)
+    // doesn't flip the decision for every path that follows.
+    constexpr static float kWeight = 1.f / 8;
+    m_interiorTriangulationNanosPerPoint +=
+        (nanosPerPoint - m_interiorTriangulationNanosPerPoint) * kWeight;
+}
+
 bool PLSRenderContext::isOutsideCurrentFrame(const IAABB& pixelBounds)
 {
     assert(m_didBeginFrame);
@@ -277,6 +401,7 @@ uint32_t PLSRenderContext::LogicalFlush::generateClipID(const IAABB& contentBoun
         assert(m_ctx->m_clipContentID != m_clips.size());
         return m_clips.size();
     }
+    RIVE_PLS_STATS_CODE(m_flushReason = LogicalFlushReason::clipIDs;)
     return 0; // There are no available clip IDs. The caller should flush and try again.
 }
 
@@ -312,41 +437,93 @@ bool PLSRenderContext::LogicalFlush::pushDrawBatch(PLSDrawUniquePtr draws[], siz
     {
         // We can only reorder 64k draws at a time since the sort key addresses them with a 16-bit
         // index.
+        RIVE_PLS_STATS_CODE(m_flushReason = LogicalFlushReason::reorderLimit;)
         return false;
     }
 
-    auto countsVector = m_resourceCounts.toVec();
+    auto countBatch = [this, draws, drawCount]() {
+        auto countsVector = m_resourceCounts.toVec();
+        for (size_t i = 0; i < drawCount; ++i)
+        {
+            countsVector += draws[i]->resourceCounts().toVec();
+        }
+        return PLSDraw::ResourceCounters(countsVector);
+    };
     for (size_t i = 0; i < drawCount; ++i)
     {
         assert(!draws[i]->pixelBounds().empty());
         assert(m_ctx->frameSupportsClipRects() || draws[i]->clipRectInverseMatrix() == nullptr);
-        countsVector += draws[i]->resourceCounts().toVec();
     }
-    PLSDraw::ResourceCounters countsWithNewBatch = countsVector;
+    PLSDraw::ResourceCounters countsWithNewBatch = countBatch();
+
+    // Triangulations that are still running on worker threads only count a reservation. If the
+    // reservations don't fit, wait for the triangulations and see if their actual counts do.
+    auto tessVertexCount = [](const PLSDraw::ResourceCounters& counts) {
+        return counts.midpointFanTessVertexCount + counts.outerCubicTessVertexCount;
+    };
+    if (tessVertexCount(countsWithNewBatch) > kMaxTessellationVertexCountBeforePadding)
+    {
+        bool didResolve = !m_pendingInteriorTriangulations.empty();
+        resolvePendingInteriorTriangulations();
+        for (size_t i = 0; i < drawCount; ++i)
+        {
+            if (draws[i]->type() == PLSDraw::Type::interiorTriangulationPath &&
+                static_cast<InteriorTriangulationDraw*>(draws[i].get())->hasPendingTriangulation())
+            {
+                resolveInteriorTriangulation(&draws[i]);
+                didResolve = true;
+            }
+        }
+        if (didResolve)
+        {
+            countsWithNewBatch = countBatch();
+        }
+    }
 
     // Textures have hard size limits. If new batch doesn't fit in one of the textures, the caller
     // needs to flush and try again.
     if (countsWithNewBatch.pathCount > m_ctx->m_maxPathID ||
         countsWithNewBatch.contourCount > kMaxContourID ||
-        countsWithNewBatch.midpointFanTessVertexCount +
-                countsWithNewBatch.outerCubicTessVertexCount >
-            kMaxTessellationVertexCountBeforePadding)
+        tessVertexCount(countsWithNewBatch) > kMaxTessellationVertexCountBeforePadding)
     {
+#ifdef RIVE_PLS_STATS
+        if (countsWithNewBatch.pathCount > m_ctx->m_maxPathID)
+        {
+            m_flushReason = LogicalFlushReason::pathIDs;
+        }
+        else if (countsWithNewBatch.contourCount > kMaxContourID)
+        {
+            m_flushReason = LogicalFlushReason::contourIDs;
+        }
+        else
+        {
+            m_flushReason = LogicalFlushReason::tessTextureHeight;
+        }
+#endif
         return false;
     }
 
     // Allocate spans in the gradient texture.
-    for (size_t i = 0; i < drawCount; ++i)
     {
-        if (!draws[i]->allocateGradientIfNeeded(this, &countsWithNewBatch))
+        RIVE_PLS_STATS_CODE(ScopedStatsTimer timer(m_ctx, &FrameStats::gradientAllocationNanos);)
+        for (size_t i = 0; i < drawCount; ++i)
         {
-            // The gradient doesn't fit. Give up and let the caller flush and try again.
-            return false;
+            if (!draws[i]->allocateGradientIfNeeded(this, &countsWithNewBatch))
+            {
+                // The gradient doesn't fit. Give up and let the caller flush and try again.
+                RIVE_PLS_STATS_CODE(m_flushReason = LogicalFlushReason::gradientRows;)
+                return false;
+            }
         }
     }
 
     for (size_t i = 0; i < drawCount; ++i)
     {
+        if (draws[i]->type() == PLSDraw::Type::interiorTriangulationPath &&
+            static_cast<InteriorTriangulationDraw*>(draws[i].get())->hasPendingTriangulation())
+        {
+            m_pendingInteriorTriangulations.push_back(m_plsDraws.size());
+        }
         m_plsDraws.push_back(std::move(draws[i]));
         m_combinedDrawBounds = m_combinedDrawBounds.join(m_plsDraws.back()->pixelBounds());
     }
@@ -355,6 +532,34 @@ bool PLSRenderContext::LogicalFlush::pushDrawBatch(PLSDrawUniquePtr draws[], siz
     return true;
 }
 
+void PLSRenderContext::LogicalFlush::resolvePendingInteriorTriangulations()
+{
+    auto countsVector = m_resourceCounts.toVec();
+    for (size_t drawIdx : m_pendingInteriorTriangulations)
+    {
+        PLSDrawUniquePtr& draw = m_plsDraws[drawIdx];
+        countsVector -= draw->resourceCounts().toVec();
+        resolveInteriorTriangulation(&draw);
+        countsVector += draw->resourceCounts().toVec();
+    }
+    m_resourceCounts = countsVector;
+    m_pendingInteriorTriangulations.clear();
+}
+
+void PLSRenderContext::LogicalFlush::resolveInteriorTriangulation(PLSDrawUniquePtr* draw)
+{
+    auto* triangulation = static_cast<InteriorTriangulationDraw*>(draw->get());
+    triangulation->resolvePendingTriangulation(m_ctx);
+    if (triangulation->overranReservation())
+    {
+        // The triangulation produced more grout than its reservation has room for, and the flush
+        // may have filled up around it. Draws can't move to another flush once they're in this
+        // one (their clip IDs belong to it), so swap in the midpoint fan fallback, which always
+        // fits in the reservation.
+        *draw = triangulation->takeMidpointFanFallback();
+    }
+}
+
 bool PLSRenderContext::LogicalFlush::allocateGradient(const PLSGradient* gradient,
                                                       PLSDraw::ResourceCounters* counters,
                                                       pls::ColorRampLocation* colorRampLocation)
@@ -432,6 +637,11 @@ void PLSRenderContext::logicalFlush()
     // between render passes.
     m_clipContentID = 0;
 
+    RIVE_PLS_STATS_CODE({
+        auto reason = static_cast<size_t>(m_logicalFlushes.back()->m_flushReason);
+        ++m_frameStats.logicalFlushReasons[reason];
+    })
+
     // Don't issue any GPU commands between logical flushes. Instead, build up a list of flushes
     // that we will submit all at once at the end of the frame.
     m_logicalFlushes.emplace_back(new LogicalFlush(this));
@@ -448,13 +658,16 @@ void PLSRenderContext::flush(const FlushResources& flushResources)
     // Layout this frame's resource buffers and textures.
     LogicalFlush::ResourceCounters totalFrameResourceCounts;
     LogicalFlush::LayoutCounters layoutCounts;
-    for (size_t i = 0; i < m_logicalFlushes.size(); ++i)
     {
-        m_logicalFlushes[i]->layoutResources(flushResources,
-                                             i,
-                                             i == m_logicalFlushes.size() - 1,
-                                             &totalFrameResourceCounts,
-                                             &layoutCounts);
+        RIVE_PLS_STATS_CODE(ScopedStatsTimer timer(this, &FrameStats::layoutResourcesNanos);)
+        for (size_t i = 0; i < m_logicalFlushes.size(); ++i)
+        {
+            m_logicalFlushes[i]->layoutResources(flushResources,
+                                                 i,
+                                                 i == m_logicalFlushes.size() - 1,
+                                                 &totalFrameResourceCounts,
+                                                 &layoutCounts);
+        }
     }
     assert(layoutCounts.maxGradTextureHeight <= kMaxTextureHeight);
     assert(layoutCounts.maxTessTextureHeight <= kMaxTextureHeight);
@@ -476,6 +689,9 @@ void PLSRenderContext::flush(const FlushResources& flushResources)
     allocs.complexGradSpanBufferCount = totalFrameResourceCounts.complexGradientSpanCount;
     allocs.tessSpanBufferCount = totalFrameResourceCounts.maxTessellatedSegmentCount;
     allocs.triangleVertexBufferCount = totalFrameResourceCounts.maxTriangleVertexCount;
+    allocs.triangleIndexBufferCount = totalFrameResourceCounts.maxTriangleIndexCount;
+    allocs.streamedMeshVertexBufferCount = totalFrameResourceCounts.streamedMeshVertexCount;
+    allocs.streamedMeshIndexBufferCount = totalFrameResourceCounts.streamedMeshIndexCount;
     allocs.gradTextureHeight = layoutCounts.maxGradTextureHeight;
     allocs.tessTextureHeight = layoutCounts.maxTessTextureHeight;
 
@@ -511,11 +727,17 @@ void PLSRenderContext::flush(const FlushResources& flushResources)
     setResourceSizes(allocs);
 
     // Write out the GPU buffers for this frame.
-    mapResourceBuffers(allocs);
+    {
+        RIVE_PLS_STATS_CODE(ScopedStatsTimer timer(this, &FrameStats::mapUnmapNanos);)
+        mapResourceBuffers(allocs);
+    }
 
-    for (const auto& flush : m_logicalFlushes)
     {
-        flush->writeResources();
+        RIVE_PLS_STATS_CODE(ScopedStatsTimer timer(this, &FrameStats::writeResourcesNanos);)
+        for (const auto& flush : m_logicalFlushes)
+        {
+            flush->writeResources();
+        }
     }
 
     assert(m_flushUniformData.elementsWritten() == m_logicalFlushes.size());
@@ -533,14 +755,26 @@ void PLSRenderContext::flush(const FlushResources& flushResources)
     assert(m_tessSpanData.elementsWritten() <= totalFrameResourceCounts.maxTessellatedSegmentCount);
     assert(m_triangleVertexData.elementsWritten() <=
            totalFrameResourceCounts.maxTriangleVertexCount);
+    assert(m_triangleIndexData.elementsWritten() <= totalFrameResourceCounts.maxTriangleIndexCount);
+    assert(m_streamedMeshVertexData.elementsWritten() ==
+           totalFrameResourceCounts.streamedMeshVertexCount);
+    assert(m_streamedMeshUVData.elementsWritten() ==
+           totalFrameResourceCounts.streamedMeshVertexCount);
+    assert(m_streamedMeshIndexData.elementsWritten() ==
+           totalFrameResourceCounts.streamedMeshIndexCount);
 
-    unmapResourceBuffers();
+    {
+        RIVE_PLS_STATS_CODE(ScopedStatsTimer timer(this, &FrameStats::mapUnmapNanos);)
+        unmapResourceBuffers();
+    }
 
     // Issue logical flushes to the backend.
     for (const auto& flush : m_logicalFlushes)
     {
         m_impl->flush(flush->desc());
+        RIVE_PLS_STATS_CODE(m_frameStats.drawBatchCount += flush->m_drawList.count();)
     }
+    RIVE_PLS_STATS_CODE(m_frameStats.logicalFlushCount = m_logicalFlushes.size();)
 
     if (!m_logicalFlushes.empty())
     {
@@ -548,6 +782,13 @@ void PLSRenderContext::flush(const FlushResources& flushResources)
         m_logicalFlushes.front()->rewind();
     }
 
+    // Draws that never made it into a logical flush may still have triangulations in flight.
+    for (const auto& job : m_interiorTriangulationJobs)
+    {
+        job->wait();
+    }
+    m_interiorTriangulationJobs.clear();
+
     // Drop all memory that was allocated for this frame using TrivialBlockAllocator.
     m_perFrameAllocator.reset();
     m_numChopsAllocator.reset();
@@ -558,6 +799,7 @@ void PLSRenderContext::flush(const FlushResources& flushResources)
 
     m_frameDescriptor = FrameDescriptor();
 
+    RIVE_PLS_STATS_CODE(m_lastFrameStats = m_frameStats;)
     RIVE_DEBUG_CODE(m_didBeginFrame = false;)
 
     // Wait to reset CPU-side containers until after the flush has finished.
@@ -567,6 +809,13 @@ void PLSRenderContext::flush(const FlushResources& flushResources)
     }
 }
 
+#ifdef RIVE_PLS_STATS
+const PLSRenderContext::GPUFrameStats* PLSRenderContext::lastGPUFrameStats() const
+{
+    return m_impl->lastGPUFrameStats();
+}
+#endif
+
 void PLSRenderContext::LogicalFlush::layoutResources(const FlushResources& flushResources,
                                                      size_t logicalFlushIdx,
                                                      bool isFinalFlushOfFrame,
@@ -577,6 +826,12 @@ void PLSRenderContext::LogicalFlush::layoutResources(const FlushResources& flush
 
     const FrameDescriptor& frameDescriptor = m_ctx->frameDescriptor();
 
+    // Every triangulation has to be finished before we can know how much room the flush needs.
+    resolvePendingInteriorTriangulations();
+    assert(m_resourceCounts.midpointFanTessVertexCount +
+               m_resourceCounts.outerCubicTessVertexCount <=
+           kMaxTessellationVertexCountBeforePadding);
+
     // Reserve a path record for the clearColor paint (used by atomic mode).
     // This also allows us to index the storage buffers directly by pathID.
     ++m_resourceCounts.pathCount;
@@ -728,6 +983,8 @@ void PLSRenderContext::LogicalFlush::layoutResources(const FlushResources& flush
     m_flushDesc.wireframe = frameDescriptor.wireframe;
     m_flushDesc.externalCommandBuffer = flushResources.externalCommandBuffer;
     m_flushDesc.isFinalFlushOfFrame = isFinalFlushOfFrame;
+    RIVE_PLS_STATS_CODE(m_flushDesc.frameNumber = m_ctx->m_frameStats.frameNumber;)
+    RIVE_PLS_STATS_CODE(m_flushDesc.gpuDrawBatchTimings = frameDescriptor.gpuDrawBatchTimings;)
 
     *runningFrameResourceCounts = runningFrameResourceCounts->toVec() + m_resourceCounts.toVec();
     runningFrameLayoutCounts->pathPaddingCount += m_pathPaddingCount;
@@ -854,6 +1111,8 @@ void PLSRenderContext::LogicalFlush::writeResources()
         intersectionBoard->resizeAndReset(m_flushDesc.renderTarget->width(),
                                           m_flushDesc.renderTarget->height());
 
+        RIVE_PLS_STATS_CODE(auto reorderStartTime = std::chrono::steady_clock::now();)
+
         // Build a list of sort keys that determine the final draw order.
         constexpr static int kDrawGroupShift = 48; // Where in the key does the draw group begin?
         constexpr static int64_t kDrawGroupMask = 0xffffllu << kDrawGroupShift;
@@ -938,6 +1197,11 @@ void PLSRenderContext::LogicalFlush::writeResources()
         // Re-order the draws!!
         std::sort(indirectDrawList.begin(), indirectDrawList.end());
 
+        RIVE_PLS_STATS_CODE(m_ctx->m_frameStats.sortAndReorderNanos +=
+                            std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                std::chrono::steady_clock::now() - reorderStartTime)
+                                .count();)
+
         // Atomic mode sometimes needs to initialize PLS with a draw when the backend can't do it
         // with typical clear/load APIs.
         if (m_ctx->frameInterlockMode() == pls::InterlockMode::atomics &&
@@ -1151,6 +1415,54 @@ void PLSRenderContext::setResourceSizes(ResourceAllocationCounts allocs, bool fo
                                            sizeof(pls::TriangleVertex));
     }
 
+    LOG_BUFFER_RING_SIZE(triangleIndexBufferCount, sizeof(uint32_t));
+    if (allocs.triangleIndexBufferCount != m_currentResourceAllocations.triangleIndexBufferCount ||
+        forceRealloc)
+    {
+        m_triangleIndexBuffer = nullptr;
+        if (size_t sizeInBytes = allocs.triangleIndexBufferCount * sizeof(uint32_t))
+        {
+            m_triangleIndexBuffer = m_impl->makeRenderBuffer(RenderBufferType::index,
+                                                             RenderBufferFlags::none,
+                                                             sizeInBytes);
+        }
+    }
+
+    LOG_BUFFER_RING_SIZE(streamedMeshVertexBufferCount, sizeof(Vec2D) * 2);
+    if (allocs.streamedMeshVertexBufferCount !=
+            m_currentResourceAllocations.streamedMeshVertexBufferCount ||
+        forceRealloc)
+    {
+        m_streamedMeshVertexBuffer = nullptr;
+        m_streamedMeshUVBuffer = nullptr;
+        if (size_t sizeInBytes = allocs.streamedMeshVertexBufferCount * sizeof(Vec2D))
+        {
+            m_streamedMeshVertexBuffer = m_impl->makeRenderBuffer(RenderBufferType::vertex,
+                                                                  RenderBufferFlags::none,
+                                                                  sizeInBytes);
+            m_streamedMeshUVBuffer = m_impl->makeRenderBuffer(RenderBufferType::vertex,
+                                                              RenderBufferFlags::none,
+                                                              sizeInBytes);
+        }
+    }
+
+    LOG_BUFFER_RING_SIZE(streamedMeshIndexBufferCount, sizeof(uint16_t));
+    if (allocs.streamedMeshIndexBufferCount !=
+            m_currentResourceAllocations.streamedMeshIndexBufferCount ||
+        forceRealloc)
+    {
+        m_streamedMeshIndexBuffer = nullptr;
+        if (allocs.streamedMeshIndexBufferCount != 0)
+        {
+            // Some APIs require buffer sizes to be multiples of 4.
+            size_t sizeInBytes = math::round_up_to_multiple_of<4>(
+                allocs.streamedMeshIndexBufferCount * sizeof(uint16_t));
+            m_streamedMeshIndexBuffer = m_impl->makeRenderBuffer(RenderBufferType::index,
+                                                                 RenderBufferFlags::none,
+                                                                 sizeInBytes);
+        }
+    }
+
     allocs.gradTextureHeight = std::min(allocs.gradTextureHeight, kMaxTextureHeight);
     LOG_TEXTURE_HEIGHT(gradTextureHeight, pls::kGradTextureWidth * 4);
     if (allocs.gradTextureHeight != m_currentResourceAllocations.gradTextureHeight || forceRealloc)
@@ -1251,6 +1563,30 @@ void PLSRenderContext::mapResourceBuffers(const ResourceAllocationCounts& mapCou
                                          mapCounts.triangleVertexBufferCount);
     }
     assert(m_triangleVertexData.hasRoomFor(mapCounts.triangleVertexBufferCount));
+
+    if (mapCounts.triangleIndexBufferCount > 0)
+    {
+        m_triangleIndexData.reset(static_cast<uint32_t*>(m_triangleIndexBuffer->map()),
+                                  mapCounts.triangleIndexBufferCount);
+    }
+    assert(m_triangleIndexData.hasRoomFor(mapCounts.triangleIndexBufferCount));
+
+    if (mapCounts.streamedMeshVertexBufferCount > 0)
+    {
+        m_streamedMeshVertexData.reset(static_cast<Vec2D*>(m_streamedMeshVertexBuffer->map()),
+                                       mapCounts.streamedMeshVertexBufferCount);
+        m_streamedMeshUVData.reset(static_cast<Vec2D*>(m_streamedMeshUVBuffer->map()),
+                                   mapCounts.streamedMeshVertexBufferCount);
+    }
+    assert(m_streamedMeshVertexData.hasRoomFor(mapCounts.streamedMeshVertexBufferCount));
+    assert(m_streamedMeshUVData.hasRoomFor(mapCounts.streamedMeshVertexBufferCount));
+
+    if (mapCounts.streamedMeshIndexBufferCount > 0)
+    {
+        m_streamedMeshIndexData.reset(static_cast<uint16_t*>(m_streamedMeshIndexBuffer->map()),
+                                      mapCounts.streamedMeshIndexBufferCount);
+    }
+    assert(m_streamedMeshIndexData.hasRoomFor(mapCounts.streamedMeshIndexBufferCount));
 }
 
 void PLSRenderContext::unmapResourceBuffers()
@@ -1297,14 +1633,31 @@ void PLSRenderContext::unmapResourceBuffers()
     }
     if (m_tessSpanData)
     {
-        m_impl->unmapTessVertexSpanBuffer();
+        m_impl->unmapTessVertexSpanBuffer(m_tessSpanData.bytesWritten());
         m_tessSpanData.reset();
     }
     if (m_triangleVertexData)
     {
-        m_impl->unmapTriangleVertexBuffer();
+        m_impl->unmapTriangleVertexBuffer(m_triangleVertexData.bytesWritten());
         m_triangleVertexData.reset();
     }
+    if (m_triangleIndexData)
+    {
+        m_triangleIndexBuffer->unmap();
+        m_triangleIndexData.reset();
+    }
+    if (m_streamedMeshVertexData)
+    {
+        m_streamedMeshVertexBuffer->unmap();
+        m_streamedMeshVertexData.reset();
+        m_streamedMeshUVBuffer->unmap();
+        m_streamedMeshUVData.reset();
+    }
+    if (m_streamedMeshIndexData)
+    {
+        m_streamedMeshIndexBuffer->unmap();
+        m_streamedMeshIndexData.reset();
+    }
 }
 
 void PLSRenderContext::LogicalFlush::pushPaddingVertices(uint32_t tessLocation, uint32_t count)
@@ -1357,6 +1710,13 @@ void PLSRenderContext::LogicalFlush::pushPath(PLSPathDraw* draw,
     assert(m_flushDesc.firstPaintAux + m_currentPathID ==
            m_ctx->m_paintAuxData.elementsWritten() - 1);
 
+    if (tessVertexCount == 0)
+    {
+        // The path has no patches. (e.g., A flattened interior triangulation in depthStencil mode,
+        // which only draws triangles.)
+        return;
+    }
+
     pls::DrawType drawType;
     size_t tessLocation;
     if (patchType == PatchType::midpointFan)
@@ -1630,16 +1990,22 @@ void PLSRenderContext::LogicalFlush::pushInteriorTriangulation(InteriorTriangula
 {
     assert(m_hasDoneLayout);
 
-    assert(m_ctx->m_triangleVertexData.hasRoomFor(draw->triangulator()->maxVertexCount()));
-    uint32_t baseVertex = m_ctx->m_triangleVertexData.elementsWritten();
-    size_t actualVertexCount =
-        draw->triangulator()->polysToTriangles(&m_ctx->m_triangleVertexData, m_currentPathID);
-    assert(actualVertexCount <= draw->triangulator()->maxVertexCount());
+    assert(m_ctx->m_triangleVertexData.hasRoomFor(draw->resourceCounts().maxTriangleVertexCount));
+    assert(m_ctx->m_triangleIndexData.hasRoomFor(draw->resourceCounts().maxTriangleIndexCount));
+    uint32_t baseIndex = m_ctx->m_triangleIndexData.elementsWritten();
+    size_t actualIndexCount = draw->writeInteriorTriangles(&m_ctx->m_triangleVertexData,
+                                                           &m_ctx->m_triangleIndexData,
+                                                           m_currentPathID);
+    assert(actualIndexCount <= draw->resourceCounts().maxTriangleIndexCount);
     DrawBatch& batch =
-        pushPathDraw(draw, DrawType::interiorTriangulation, actualVertexCount, baseVertex);
-    // Interior triangulations are allowed to disable raster ordering since they are guaranteed to
-    // not overlap.
-    batch.needsBarrier = true;
+        pushPathDraw(draw, DrawType::interiorTriangulation, actualIndexCount, baseIndex);
+    batch.indexBuffer = m_ctx->m_triangleIndexBuffer.get();
+    if (m_flushDesc.interlockMode != pls::InterlockMode::depthStencil)
+    {
+        // Interior triangulations are allowed to disable raster ordering since they are guaranteed
+        // to not overlap.
+        batch.needsBarrier = true;
+    }
 }
 
 void PLSRenderContext::LogicalFlush::pushImageRect(ImageRectDraw* draw)
@@ -1675,6 +2041,28 @@ void PLSRenderContext::LogicalFlush::pushImageMesh(ImageMeshDraw* draw)
                                                draw->blendMode(),
                                                m_currentZIndex);
 
+    if (const StreamedImageMesh* streamedMesh = draw->streamedMesh())
+    {
+        // Have the client write the mesh directly into our mapped buffers. The vertex and uv
+        // buffers get bound at an offset, so the mesh's indices don't need to be rebased.
+        uint32_t vertexCount = streamedMesh->vertexCount();
+        uint32_t vertexDataOffsetInBytes = m_ctx->m_streamedMeshVertexData.bytesWritten();
+        uint32_t baseIndex = m_ctx->m_streamedMeshIndexData.elementsWritten();
+        assert(m_ctx->m_streamedMeshUVData.bytesWritten() == vertexDataOffsetInBytes);
+        streamedMesh->writeVertices(m_ctx->m_streamedMeshVertexData.alloc_back_n(vertexCount),
+                                    m_ctx->m_streamedMeshUVData.alloc_back_n(vertexCount));
+        streamedMesh->writeIndices(m_ctx->m_streamedMeshIndexData.alloc_back_n(draw->indexCount()));
+
+        DrawBatch& batch =
+            pushDraw(draw, DrawType::imageMesh, PaintType::image, draw->indexCount(), baseIndex);
+        batch.vertexBuffer = m_ctx->m_streamedMeshVertexBuffer.get();
+        batch.uvBuffer = m_ctx->m_streamedMeshUVBuffer.get();
+        batch.indexBuffer = m_ctx->m_streamedMeshIndexBuffer.get();
+        batch.vertexDataOffsetInBytes = vertexDataOffsetInBytes;
+        batch.imageDrawDataOffset = imageDrawDataOffset;
+        return;
+    }
+
     DrawBatch& batch = pushDraw(draw, DrawType::imageMesh, PaintType::image, draw->indexCount(), 0);
     batch.vertexBuffer = draw->vertexBuffer();
     batch.uvBuffer = draw->uvBuffer();
@@ -1708,6 +2096,7 @@ void PLSRenderContext::LogicalFlush::pushBarrier()
 
     if (!m_drawList.empty())
     {
+        RIVE_PLS_STATS_CODE(m_ctx->m_frameStats.barrierCount += !m_drawList.tail().needsBarrier;)
         m_drawList.tail().needsBarrier = true;
     }
 }
@@ -4,6 +4,7 @@
 
 #include "rive/pls/pls_render_context_helper_impl.hpp"
 
+#include "ktx2.hpp"
 #include "rive/pls/pls_image.hpp"
 #include "shaders/constants.glsl"
 
@@ -15,6 +16,35 @@ namespace rive::pls
 {
 rcp<PLSTexture> PLSRenderContextHelperImpl::decodeImageTexture(Span<const uint8_t> encodedBytes)
 {
+    if (IsKTX2(encodedBytes))
+    {
+        // Block-compressed images are uploaded as-is. We don't transcode them on the CPU, so fail
+        // if the GPU can't sample the format directly.
+        KTX2Image ktx2;
+        if (!ParseKTX2(encodedBytes, &ktx2) ||
+            !platformFeatures().supportsCompressedTextureFormat(ktx2.format))
+        {
+            return nullptr;
+        }
+        return makeCompressedImageTexture(ktx2.width,
+                                          ktx2.height,
+                                          ktx2.format,
+                                          ktx2.mipLevels.data(),
+                                          ktx2.mipLevels.size());
+    }
+    DecodedImage decodedImage;
+    if (decodeImagePixels(encodedBytes, &decodedImage))
+    {
+        return makeDecodedImageTexture(decodedImage);
+    }
+    return nullptr;
+}
+
+bool PLSRenderContextHelperImpl::decodeImagePixels(Span<const uint8_t> encodedBytes,
+                                                   DecodedImage* decodedImage)
+{
+    // KTX2 payloads are already GPU-ready and go through decodeImageTexture() instead.
+    assert(!IsKTX2(encodedBytes));
 #ifdef RIVE_DECODERS
     auto bitmap = Bitmap::decode(encodedBytes.data(), encodedBytes.size());
     if (bitmap)
@@ -24,13 +54,25 @@ rcp<PLSTexture> PLSRenderContextHelperImpl::decodeImageTexture(Span<const uint8_
         {
             bitmap->pixelFormat(Bitmap::PixelFormat::RGBA);
         }
-        uint32_t width = bitmap->width();
-        uint32_t height = bitmap->height();
-        uint32_t mipLevelCount = math::msb(height | width);
-        return makeImageTexture(width, height, mipLevelCount, bitmap->bytes());
+        decodedImage->width = bitmap->width();
+        decodedImage->height = bitmap->height();
+        decodedImage->pixelsRGBA = bitmap->bytes();
+        // Hold on to the Bitmap itself instead of copying its pixels out.
+        decodedImage->storage = std::shared_ptr<const Bitmap>(std::move(bitmap));
+        return true;
     }
 #endif
-    return nullptr;
+    return false;
+}
+
+rcp<PLSTexture> PLSRenderContextHelperImpl::makeDecodedImageTexture(const DecodedImage& decodedImage)
+{
+    assert(decodedImage.pixelsRGBA != nullptr);
+    uint32_t mipLevelCount = math::msb(decodedImage.height | decodedImage.width);
+    return makeImageTexture(decodedImage.width,
+                            decodedImage.height,
+                            mipLevelCount,
+                            decodedImage.pixelsRGBA);
 }
 
 void PLSRenderContextHelperImpl::resizeFlushUniformBuffer(size_t sizeInBytes)
@@ -162,13 +204,13 @@ void PLSRenderContextHelperImpl::unmapSimpleColorRampsBuffer()
 
 void PLSRenderContextHelperImpl::unmapGradSpanBuffer() { m_gradSpanBuffer->unmapAndSubmitBuffer(); }
 
-void PLSRenderContextHelperImpl::unmapTessVertexSpanBuffer()
+void PLSRenderContextHelperImpl::unmapTessVertexSpanBuffer(size_t bytesWritten)
 {
-    m_tessSpanBuffer->unmapAndSubmitBuffer();
+    m_tessSpanBuffer->unmapAndSubmitBuffer(bytesWritten);
 }
 
-void PLSRenderContextHelperImpl::unmapTriangleVertexBuffer()
+void PLSRenderContextHelperImpl::unmapTriangleVertexBuffer(size_t bytesWritten)
 {
-    m_triangleBuffer->unmapAndSubmitBuffer();
+    m_triangleBuffer->unmapAndSubmitBuffer(bytesWritten);
 }
 } // namespace rive::pls
@@ -4,12 +4,14 @@
 
 #include "rive/pls/pls_renderer.hpp"
 
+#include "dash_path.hpp"
 #include "pls_paint.hpp"
 #include "pls_path.hpp"
 #include "rive/math/math_types.hpp"
 #include "rive/math/simd.hpp"
 #include "rive/pls/pls_image.hpp"
 #include "shaders/constants.glsl"
+#include "stroke_outline.hpp"
 
 namespace rive::pls
 {
@@ -100,6 +102,10 @@ void PLSRenderer::transform(const Mat2D& matrix)
 
 void PLSRenderer::drawPath(RenderPath* renderPath, RenderPaint* renderPaint)
 {
+    RIVE_PLS_STATS_CODE(PLSRenderContext::ScopedStatsTimer timer(
+        m_context,
+        &PLSRenderContext::FrameStats::drawConstructionNanos);)
+
     LITE_RTTI_CAST_OR_RETURN(path, PLSPath*, renderPath);
     LITE_RTTI_CAST_OR_RETURN(paint, PLSPaint*, renderPaint);
 
@@ -119,14 +125,206 @@ void PLSRenderer::drawPath(RenderPath* renderPath, RenderPaint* renderPaint)
         return;
     }
 
+    rcp<PLSPath> pathToDraw = ref_rcp(path);
+    if (stroked && paint->getIsDashed())
+    {
+        if (m_pathDasher == nullptr)
+        {
+            m_pathDasher = std::make_unique<PathDasher>();
+        }
+        rcp<PLSPath> dashedPath = makeScratchPath();
+        RawPath* dashedRawPath = dashedPath->mutableRawPath();
+        const std::vector<float>& intervals = paint->getDashIntervals();
+        if (m_pathDasher->dash(path->getRawPath(),
+                               m_stack.back().matrix,
+                               intervals.data(),
+                               intervals.size(),
+                               paint->getDashPhase(),
+                               dashedRawPath))
+        {
+            dashedRawPath->pruneEmptySegments();
+            if (dashedRawPath->empty())
+            {
+                return; // Every dash fell in an "off" interval.
+            }
+            pathToDraw = std::move(dashedPath);
+        }
+    }
+
+    const Mat2D& matrix = m_stack.back().matrix;
+    float strokeTriangulationMinWidth = m_context->frameDescriptor().strokeTriangulationMinWidth;
+    if (stroked && strokeTriangulationMinWidth > 0 &&
+        paint->getThickness() * matrix.findMaxScale() >= strokeTriangulationMinWidth)
+    {
+        float strokeRadius = paint->getThickness() * .5f;
+        // Outset the bounds the same way PLSPathDraw::Make() does, so miters and square caps
+        // count toward the area.
+        float strokeOutset = strokeRadius;
+        if (paint->getJoin() == StrokeJoin::miter)
+        {
+            strokeOutset *= 4;
+        }
+        else if (paint->getCap() == StrokeCap::square)
+        {
+            strokeOutset *= math::SQRT2;
+        }
+        AABB strokeBounds = pathToDraw->getBounds().inset(-strokeOutset, -strokeOutset);
+        if (m_context->shouldTriangulateInterior(pls::FindTransformedArea(strokeBounds, matrix),
+                                                 pathToDraw->getRawPath().points().count()))
+        {
+            if (m_strokeOutliner == nullptr)
+            {
+                m_strokeOutliner = std::make_unique<StrokeOutliner>();
+            }
+            rcp<PLSPath> outlinePath = makeScratchPath();
+            RawPath* outlineRawPath = outlinePath->mutableRawPath();
+            m_strokeOutliner->outline(pathToDraw->getRawPath(),
+                                      matrix,
+                                      strokeRadius,
+                                      paint->getJoin(),
+                                      paint->getCap(),
+                                      outlineRawPath);
+            outlineRawPath->pruneEmptySegments();
+            if (outlineRawPath->empty())
+            {
+                return; // Every contour was empty and had butt caps.
+            }
+            clipAndPushDraw(PLSPathDraw::MakeStrokeOutline(m_context,
+                                                           matrix,
+                                                           std::move(outlinePath),
+                                                           paint,
+                                                           &m_scratchPath));
+            return;
+        }
+    }
+
     clipAndPushDraw(PLSPathDraw::Make(m_context,
-                                      m_stack.back().matrix,
-                                      ref_rcp(path),
+                                      matrix,
+                                      std::move(pathToDraw),
                                       path->getFillRule(),
                                       paint,
                                       &m_scratchPath));
 }
 
+void PLSRenderer::drawPaths(RenderPath* const renderPaths[],
+                            const Mat2D pathMatrices[],
+                            size_t count,
+                            RenderPaint* renderPaint)
+{
+    if (count == 0)
+    {
+        return;
+    }
+    auto paint = lite_rtti_cast<PLSPaint*>(renderPaint);
+    bool stroked = paint != nullptr && paint->getIsStroked();
+    if (count == 1 || !canMergePaths(renderPaths, pathMatrices, count, stroked))
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            if (pathMatrices != nullptr)
+            {
+                save();
+                transform(pathMatrices[i]);
+            }
+            drawPath(renderPaths[i], renderPaint);
+            if (pathMatrices != nullptr)
+            {
+                restore();
+            }
+        }
+        return;
+    }
+
+    rcp<PLSPath> mergedPath = makeScratchPath();
+    mergedPath->fillRule(static_cast<PLSPath*>(renderPaths[0])->getFillRule());
+    for (size_t i = 0; i < count; ++i)
+    {
+        mergedPath->addRenderPath(renderPaths[i],
+                                  pathMatrices != nullptr ? pathMatrices[i] : Mat2D());
+    }
+    drawPath(mergedPath.get(), renderPaint);
+}
+
+bool PLSRenderer::canMergePaths(RenderPath* const renderPaths[],
+                                const Mat2D pathMatrices[],
+                                size_t count,
+                                bool stroked)
+{
+    auto pathAt = [renderPaths](size_t i) { return lite_rtti_cast<PLSPath*>(renderPaths[i]); };
+    auto matrixAt = [pathMatrices](size_t i) {
+        return pathMatrices != nullptr ? pathMatrices[i] : Mat2D();
+    };
+    for (size_t i = 0; i < count; ++i)
+    {
+        if (pathAt(i) == nullptr)
+        {
+            return false;
+        }
+    }
+    if (stroked)
+    {
+        // Strokes ignore the fill rule and winding direction, but the merged path gets stroked
+        // after its matrices are applied. Only merge strokes that don't get scaled, rotated, or
+        // skewed, so their widths and dash lengths don't change.
+        for (size_t i = 0; pathMatrices != nullptr && i < count; ++i)
+        {
+            const Mat2D& m = pathMatrices[i];
+            if (m.xx() != 1 || m.xy() != 0 || m.yx() != 0 || m.yy() != 1)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+    for (size_t i = 1; i < count; ++i)
+    {
+        if (pathAt(i)->getFillRule() != pathAt(0)->getFillRule())
+        {
+            return false;
+        }
+    }
+    // Where fills overlap, their windings add up. Overlapping evenOdd paths cut holes in each
+    // other, and so do nonZero paths (or contours within them) that wind in opposite directions.
+    // So only merge fills if their bounds are disjoint. This is quadratic in the number of paths,
+    // so give up on large batches.
+    if (count > kMaxFillsToMerge)
+    {
+        return false;
+    }
+    AABB bounds[kMaxFillsToMerge];
+    for (size_t i = 0; i < count; ++i)
+    {
+        bounds[i] = matrixAt(i).mapBoundingBox(pathAt(i)->getBounds());
+        for (size_t j = 0; j < i; ++j)
+        {
+            if (bounds[i].left() < bounds[j].right() && bounds[j].left() < bounds[i].right() &&
+                bounds[i].top() < bounds[j].bottom() && bounds[j].top() < bounds[i].bottom())
+            {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+rcp<PLSPath> PLSRenderer::makeScratchPath()
+{
+    if (m_scratchPathsFrameCount != m_context->frameCount())
+    {
+        // Every draw from the previous frame has released its reference.
+        m_scratchPathsInUse = 0;
+        m_scratchPathsFrameCount = m_context->frameCount();
+    }
+    if (m_scratchPathsInUse == m_scratchPaths.size())
+    {
+        m_scratchPaths.push_back(make_rcp<PLSPath>());
+    }
+    rcp<PLSPath> path = m_scratchPaths[m_scratchPathsInUse++];
+    path->rewind();
+    path->fillRule(FillRule::nonZero);
+    return path;
+}
+
 void PLSRenderer::clipPath(RenderPath* renderPath)
 {
     LITE_RTTI_CAST_OR_RETURN(path, PLSPath*, renderPath);
@@ -238,6 +436,10 @@ void PLSRenderer::clipPathImpl(const PLSPath* path)
 void PLSRenderer::drawImage(const RenderImage* renderImage, BlendMode blendMode, float opacity)
 {
     LITE_RTTI_CAST_OR_RETURN(image, const PLSImage*, renderImage);
+    if (image->getTexture() == nullptr)
+    {
+        return; // The image is still being decoded asynchronously.
+    }
 
     // Scale the view matrix so we can draw this image as the rect [0, 0, 1, 1].
     save();
@@ -247,6 +449,9 @@ void PLSRenderer::drawImage(const RenderImage* renderImage, BlendMode blendMode,
     {
         // Fall back on ImageRectDraw if the current frame doesn't support drawing paths with image
         // paints.
+        RIVE_PLS_STATS_CODE(PLSRenderContext::ScopedStatsTimer timer(
+            m_context,
+            &PLSRenderContext::FrameStats::drawConstructionNanos);)
         const Mat2D& m = m_stack.back().matrix;
         auto plsImage = static_cast<const PLSImage*>(renderImage);
         clipAndPushDraw(PLSDrawUniquePtr(
@@ -288,6 +493,13 @@ void PLSRenderer::drawImageMesh(const RenderImage* renderImage,
 {
     LITE_RTTI_CAST_OR_RETURN(image, const PLSImage*, renderImage);
     const PLSTexture* plsTexture = image->getTexture();
+    if (plsTexture == nullptr)
+    {
+        return; // The image is still being decoded asynchronously.
+    }
+    RIVE_PLS_STATS_CODE(PLSRenderContext::ScopedStatsTimer timer(
+        m_context,
+        &PLSRenderContext::FrameStats::drawConstructionNanos);)
 
     assert(vertices_f32);
     assert(uvCoords_f32);
@@ -304,6 +516,35 @@ void PLSRenderer::drawImageMesh(const RenderImage* renderImage,
                                                                     opacity)));
 }
 
+void PLSRenderer::drawStreamedImageMesh(const RenderImage* renderImage,
+                                        rcp<const StreamedImageMesh> streamedMesh,
+                                        BlendMode blendMode,
+                                        float opacity)
+{
+    LITE_RTTI_CAST_OR_RETURN(image, const PLSImage*, renderImage);
+    const PLSTexture* plsTexture = image->getTexture();
+    if (plsTexture == nullptr)
+    {
+        return; // The image is still being decoded asynchronously.
+    }
+    RIVE_PLS_STATS_CODE(PLSRenderContext::ScopedStatsTimer timer(
+        m_context,
+        &PLSRenderContext::FrameStats::drawConstructionNanos);)
+
+    assert(streamedMesh);
+    if (streamedMesh->vertexCount() == 0 || streamedMesh->indexCount() == 0)
+    {
+        return;
+    }
+
+    clipAndPushDraw(PLSDrawUniquePtr(m_context->make<ImageMeshDraw>(PLSDraw::kFullscreenPixelBounds,
+                                                                    m_stack.back().matrix,
+                                                                    blendMode,
+                                                                    ref_rcp(plsTexture),
+                                                                    std::move(streamedMesh),
+                                                                    opacity)));
+}
+
 void PLSRenderer::clipAndPushDraw(PLSDrawUniquePtr draw)
 {
     if (m_context->isOutsideCurrentFrame(draw->pixelBounds()))
@@ -72,8 +72,15 @@ VERTEX_MAIN(@drawVertexMain, Attrs, attrs, _vertexID, _instanceID)
 
 #ifdef @DRAW_INTERIOR_TRIANGLES
     vertexPosition = unpack_interior_triangle_vertex(@a_triangleVertex,
-                                                     pathID,
-                                                     v_windingWeight VERTEX_CONTEXT_UNPACK);
+                                                     pathID
+#ifndef @USING_DEPTH_STENCIL
+                                                     ,
+                                                     v_windingWeight
+#else
+                                                     ,
+                                                     pathZIndex
+#endif
+                                                         VERTEX_CONTEXT_UNPACK);
 #else
     shouldDiscardVertex = !unpack_tessellated_path_vertex(@a_patchVertexData,
                                                           @a_mirroredVertexData,
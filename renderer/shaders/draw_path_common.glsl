@@ -284,14 +284,26 @@ INLINE bool unpack_tessellated_path_vertex(float4 patchVertexData,
 
 #ifdef @DRAW_INTERIOR_TRIANGLES
 INLINE float2 unpack_interior_triangle_vertex(float3 triangleVertex,
-                                              OUT(ushort) o_pathID,
-                                              OUT(half) o_windingWeight VERTEX_CONTEXT_DECL)
+                                              OUT(ushort) o_pathID
+#ifndef @USING_DEPTH_STENCIL
+                                              ,
+                                              OUT(half) o_windingWeight
+#else
+                                              ,
+                                              OUT(ushort) o_pathZIndex
+#endif
+                                                  VERTEX_CONTEXT_DECL)
 {
     o_pathID = make_ushort(floatBitsToUint(triangleVertex.z) & 0xffffu);
     float2x2 M = make_float2x2(uintBitsToFloat(STORAGE_BUFFER_LOAD4(@pathBuffer, o_pathID * 2u)));
     uint4 pathData = STORAGE_BUFFER_LOAD4(@pathBuffer, o_pathID * 2u + 1u);
     float2 translate = uintBitsToFloat(pathData.xy);
+#ifndef @USING_DEPTH_STENCIL
     o_windingWeight = float(floatBitsToInt(triangleVertex.z) >> 16) * sign(determinant(M));
+#else
+    // depthStencil triangulations only cover the path's filled area, so they don't need weights.
+    o_pathZIndex = make_ushort(pathData.w);
+#endif
     return MUL(M, triangleVertex.xy) + translate;
 }
 #endif // @DRAW_INTERIOR_TRIANGLES
@@ -0,0 +1,438 @@
+/*
+ * Copyright 2024 Rive
+ */
+
+#include "stroke_outline.hpp"
+
+#include "path_utils.hpp"
+#include "rive/math/math_types.hpp"
+#include "rive/math/wangs_formula.hpp"
+#include "rive/pls/pls.hpp"
+
+#include <algorithm>
+
+namespace rive::pls
+{
+namespace
+{
+// Tangents shorter than this are treated as degenerate.
+constexpr static float kDegenerateTangentLength = 1e-5f;
+
+// Miters longer than 4x the stroke radius revert to bevel joins, the same as the GPU strokes. The
+// miter length is radius / cos(theta/2), and 1 + cos(theta) = 2 * cos^2(theta/2).
+constexpr static float kMinMiterDot = 2.f / (4 * 4) - 1;
+
+Vec2D normal(Vec2D tangent) { return {-tangent.y, tangent.x}; }
+
+// Returns 'v' normalized, or false if it is too short to have a direction.
+bool normalize(Vec2D v, Vec2D* out)
+{
+    float length = v.length();
+    if (!(length > kDegenerateTangentLength))
+    {
+        return false;
+    }
+    *out = v * (1 / length);
+    return true;
+}
+
+// Matches empty_stroke_cap() in pls_draw.cpp.
+StrokeCap empty_stroke_cap(bool closed, StrokeJoin join, StrokeCap cap)
+{
+    if (closed)
+    {
+        switch (join)
+        {
+            case StrokeJoin::round:
+                return StrokeCap::round;
+            case StrokeJoin::miter:
+                return StrokeCap::square;
+            case StrokeJoin::bevel:
+                return StrokeCap::butt;
+        }
+    }
+    return cap;
+}
+
+// Adds a circular arc around 'center' from 'from' to 'to', sweeping 'sweep' radians in the
+// direction that initially heads toward 'dir'. The arc is split into cubics of no more than 90
+// degrees each.
+template <typename Sink>
+void add_arc(Sink* sink, Vec2D center, Vec2D from, Vec2D to, float sweep, Vec2D dir)
+{
+    Vec2D v0 = from - center;
+    float direction = Vec2D::cross(v0, dir) >= 0 ? 1 : -1;
+    int cubicCount = std::max(static_cast<int>(ceilf(sweep * (2 / math::PI) - 1e-3f)), 1);
+    float step = direction * sweep / cubicCount;
+    // Distance of the control points along the tangents, relative to the radius. Signed, so it
+    // also accounts for the direction of rotation.
+    float k = 4.f / 3 * tanf(step / 4);
+    float cosStep = cosf(step), sinStep = sinf(step);
+    for (int i = 0; i < cubicCount; ++i)
+    {
+        Vec2D v1 = i == cubicCount - 1 ? to - center
+                                       : Vec2D{v0.x * cosStep - v0.y * sinStep,
+                                               v0.x * sinStep + v0.y * cosStep};
+        sink->cubic(center + v0 + normal(v0) * k, center + v1 - normal(v1) * k, center + v1);
+        v0 = v1;
+    }
+}
+} // namespace
+
+void StrokeOutliner::outline(const RawPath& path,
+                             const Mat2D& matrix,
+                             float radius,
+                             StrokeJoin join,
+                             StrokeCap cap,
+                             RawPath* dst)
+{
+    dst->rewind();
+    m_radius = radius;
+    m_polarSegmentsPerRadian =
+        pathutils::CalcPolarSegmentsPerRadian<kPolarPrecision>(radius * matrix.findMaxScale());
+    m_join = join;
+    m_cap = cap;
+    m_matrix = matrix;
+
+    Vec2D contourStart = {0, 0}, lastPt = {0, 0};
+    bool hasContour = false;
+    for (auto [verb, pts] : path)
+    {
+        switch (verb)
+        {
+            case PathVerb::move:
+                if (hasContour)
+                {
+                    outlineContour(false, contourStart, dst);
+                }
+                m_segments.clear();
+                contourStart = lastPt = pts[0];
+                hasContour = true;
+                break;
+            case PathVerb::line:
+                addLine(pts[0], pts[1]);
+                lastPt = pts[1];
+                break;
+            case PathVerb::quad:
+                RIVE_UNREACHABLE();
+            case PathVerb::cubic:
+                addCubic(pts);
+                lastPt = pts[3];
+                break;
+            case PathVerb::close:
+                addLine(lastPt, contourStart);
+                outlineContour(true, contourStart, dst);
+                m_segments.clear();
+                lastPt = contourStart;
+                hasContour = false;
+                break;
+        }
+    }
+    if (hasContour)
+    {
+        outlineContour(false, contourStart, dst);
+    }
+}
+
+void StrokeOutliner::addLine(Vec2D p0, Vec2D p1)
+{
+    Vec2D tangent;
+    if (!normalize(p1 - p0, &tangent))
+    {
+        return;
+    }
+    Segment& segment = m_segments.emplace_back();
+    segment.verb = PathVerb::line;
+    segment.pts[0] = p0;
+    segment.pts[1] = p1;
+    segment.tan0 = segment.tan1 = tangent;
+    segment.followsCusp = false;
+}
+
+void StrokeOutliner::addCubic(const Vec2D pts[4])
+{
+    float T[2];
+    bool areCusps;
+    int chopCount = pathutils::FindCubicConvex180Chops(pts, T, &areCusps);
+    Vec2D chops[10];
+    if (chopCount == 1)
+    {
+        pathutils::ChopCubicAt(pts, chops, T[0]);
+    }
+    else if (chopCount == 2)
+    {
+        pathutils::ChopCubicAt(pts, chops, T[0], T[1]);
+    }
+    else
+    {
+        std::copy_n(pts, 4, chops);
+    }
+    for (int i = 0; i <= chopCount; ++i)
+    {
+        const Vec2D* p = chops + i * 3;
+        Segment segment;
+        // The tangents at the ends of a cubic can be degenerate if control points coincide with
+        // their neighboring endpoints (always the case at a cusp).
+        if (!normalize(p[1] - p[0], &segment.tan0) && !normalize(p[2] - p[0], &segment.tan0) &&
+            !normalize(p[3] - p[0], &segment.tan0))
+        {
+            continue; // The cubic is a single point.
+        }
+        if (!normalize(p[3] - p[2], &segment.tan1) && !normalize(p[3] - p[1], &segment.tan1))
+        {
+            normalize(p[3] - p[0], &segment.tan1);
+        }
+        segment.verb = PathVerb::cubic;
+        std::copy_n(p, 4, segment.pts);
+        segment.followsCusp = i > 0 && areCusps;
+        m_segments.push_back(segment);
+    }
+}
+
+void StrokeOutliner::outlineContour(bool closed, Vec2D contourStart, RawPath* dst)
+{
+    if (m_segments.empty())
+    {
+        emptyContour(contourStart, closed, dst);
+        return;
+    }
+
+    const Segment& first = m_segments.front();
+    Vec2D startNormal = normal(first.tan0) * m_radius;
+    m_left.reset(first.pts[0] + startNormal);
+    m_right.reset(first.pts[0] - startNormal);
+    for (size_t i = 0; i < m_segments.size(); ++i)
+    {
+        const Segment& segment = m_segments[i];
+        if (i > 0)
+        {
+            join(segment.pts[0],
+                 m_segments[i - 1].tan1,
+                 segment.tan0,
+                 segment.followsCusp ? StrokeJoin::round : m_join);
+        }
+        offsetSegment(segment);
+    }
+
+    const Segment& last = m_segments.back();
+    if (closed)
+    {
+        // Each side becomes its own loop. The right side runs backwards, so the two loops wind in
+        // opposite directions and only the area between them has a nonzero winding number.
+        join(first.pts[0], last.tan1, first.tan0, m_join);
+        dst->move(m_left.pts[0]);
+        replayForward(m_left, dst);
+        dst->close();
+        dst->move(m_right.pts.back());
+        replayBackward(m_right, dst);
+        dst->close();
+    }
+    else
+    {
+        // Walk forward along the left side, cap the end, walk back along the right side, and cap
+        // the beginning.
+        Vec2D endPt = last.verb == PathVerb::line ? last.pts[1] : last.pts[3];
+        dst->move(m_left.pts[0]);
+        replayForward(m_left, dst);
+        cap(dst, endPt, last.tan1, normal(last.tan1));
+        replayBackward(m_right, dst);
+        cap(dst, first.pts[0], first.tan0 * -1, normal(first.tan0) * -1);
+        dst->close();
+    }
+}
+
+void StrokeOutliner::join(Vec2D pt, Vec2D tan0, Vec2D tan1, StrokeJoin join)
+{
+    float cross = Vec2D::cross(tan0, tan1);
+    float dot = Vec2D::dot(tan0, tan1);
+    if (cross == 0 && dot > 0)
+    {
+        return; // The segments are collinear and both sides already line up.
+    }
+
+    // The side the contour turns toward is the inner side. Route it through the join point, which
+    // leaves a (harmless) region of double coverage instead of a notch.
+    bool leftIsInner = cross > 0;
+    Side* inner = leftIsInner ? &m_left : &m_right;
+    Side* outer = leftIsInner ? &m_right : &m_left;
+    float outerRadius = leftIsInner ? -m_radius : m_radius;
+    Vec2D outer0 = pt + normal(tan0) * outerRadius;
+    Vec2D outer1 = pt + normal(tan1) * outerRadius;
+    inner->line(pt);
+    inner->line(pt - normal(tan1) * outerRadius);
+
+    switch (join)
+    {
+        case StrokeJoin::miter:
+            if (dot >= kMinMiterDot)
+            {
+                outer->line(pt + (normal(tan0) + normal(tan1)) * (outerRadius / (1 + dot)));
+            }
+            break;
+        case StrokeJoin::round:
+            add_arc(outer,
+                    pt,
+                    outer0,
+                    outer1,
+                    pathutils::MeasureAngleBetweenVectors(tan0, tan1),
+                    tan0);
+            return;
+        case StrokeJoin::bevel:
+            break;
+    }
+    outer->line(outer1);
+}
+
+void StrokeOutliner::offsetSegment(const Segment& segment)
+{
+    if (segment.verb == PathVerb::line)
+    {
+        Vec2D offset = normal(segment.tan1) * m_radius;
+        m_left.line(segment.pts[1] + offset);
+        m_right.line(segment.pts[1] - offset);
+        return;
+    }
+
+    // Offset the cubic as a polyline. Each chord needs to be fine enough for both the curvature of
+    // the centerline (parametric segments) and the rotation of the offset (polar segments).
+    const Vec2D* p = segment.pts;
+    float parametricSegments =
+        wangs_formula::cubic(p, kParametricPrecision, wangs_formula::VectorXform(m_matrix));
+    float polarSegments =
+        pathutils::MeasureAngleBetweenVectors(segment.tan0, segment.tan1) * m_polarSegmentsPerRadian;
+    uint32_t chordCount = static_cast<uint32_t>(
+        std::clamp(ceilf(parametricSegments + polarSegments), 1.f, kMaxChordsPerCubic));
+
+    // Offset each chord like a line, along the chord's own normal, and join it to the chord before.
+    // Offsetting the centerline's points along the curve normals instead would fold the inner side
+    // back on itself wherever the radius is larger than the radius of curvature, and the folded
+    // part would wind backwards and cancel out coverage. join() routes the inner side through the
+    // centerline between chords, so every chord's offset stays a rectangle that winds the same
+    // direction as the rest of the outline.
+    //
+    // Power basis form: P(t) = ((A*t + B)*t + C)*t + P0.
+    Vec2D C = (p[1] - p[0]) * 3;
+    Vec2D B = (p[2] - p[1] * 2 + p[0]) * 3;
+    Vec2D A = p[3] + (p[1] - p[2]) * 3 - p[0];
+    Vec2D chordStart = p[0];
+    Vec2D tangent = segment.tan0;
+    for (uint32_t i = 1; i <= chordCount; ++i)
+    {
+        float t = static_cast<float>(i) / chordCount;
+        Vec2D pt = i == chordCount ? p[3] : ((A * t + B) * t + C) * t + p[0];
+        Vec2D chordTangent;
+        if (!normalize(pt - chordStart, &chordTangent))
+        {
+            continue; // Merge chords too short to have a direction into the next one.
+        }
+        join(chordStart, tangent, chordTangent, chordJoin(tangent, chordTangent));
+        Vec2D offset = normal(chordTangent) * m_radius;
+        m_left.line(pt + offset);
+        m_right.line(pt - offset);
+        chordStart = pt;
+        tangent = chordTangent;
+    }
+    // Leave both sides at the normal of the segment's end tangent, where the next join expects
+    // them.
+    join(chordStart, tangent, segment.tan1, chordJoin(tangent, segment.tan1));
+}
+
+StrokeJoin StrokeOutliner::chordJoin(Vec2D tan0, Vec2D tan1) const
+{
+    // Chords are evenly spaced in T, so where the curvature spikes, a single chord can turn much
+    // further than one polar segment. Bevels would cut the corner off of the offset there.
+    float polarSegments =
+        pathutils::MeasureAngleBetweenVectors(tan0, tan1) * m_polarSegmentsPerRadian;
+    return polarSegments > 1 ? StrokeJoin::round : StrokeJoin::bevel;
+}
+
+void StrokeOutliner::cap(RawPath* dst, Vec2D pt, Vec2D tangent, Vec2D normal)
+{
+    Vec2D from = pt + normal * m_radius;
+    Vec2D to = pt - normal * m_radius;
+    switch (m_cap)
+    {
+        case StrokeCap::butt:
+            dst->line(to);
+            break;
+        case StrokeCap::square:
+        {
+            Vec2D extension = tangent * m_radius;
+            dst->line(from + extension);
+            dst->line(to + extension);
+            dst->line(to);
+            break;
+        }
+        case StrokeCap::round:
+            add_arc(dst, pt, from, to, math::PI, tangent);
+            break;
+    }
+}
+
+void StrokeOutliner::emptyContour(Vec2D pt, bool closed, RawPath* dst)
+{
+    // Like the GPU strokes, empty contours draw their cap as if the contour pointed to the right.
+    switch (empty_stroke_cap(closed, m_join, m_cap))
+    {
+        case StrokeCap::butt:
+            break;
+        case StrokeCap::square:
+            dst->move({pt.x - m_radius, pt.y - m_radius});
+            dst->line({pt.x + m_radius, pt.y - m_radius});
+            dst->line({pt.x + m_radius, pt.y + m_radius});
+            dst->line({pt.x - m_radius, pt.y + m_radius});
+            dst->close();
+            break;
+        case StrokeCap::round:
+        {
+            Vec2D top = pt + Vec2D{0, -m_radius};
+            Vec2D bottom = pt + Vec2D{0, m_radius};
+            dst->move(top);
+            add_arc(dst, pt, top, bottom, math::PI, Vec2D{1, 0});
+            add_arc(dst, pt, bottom, top, math::PI, Vec2D{-1, 0});
+            dst->close();
+            break;
+        }
+    }
+}
+
+void StrokeOutliner::replayForward(const Side& side, RawPath* dst)
+{
+    const Vec2D* pts = side.pts.data();
+    for (PathVerb verb : side.verbs)
+    {
+        if (verb == PathVerb::line)
+        {
+            dst->line(pts[1]);
+            pts += 1;
+        }
+        else
+        {
+            assert(verb == PathVerb::cubic);
+            dst->cubic(pts[1], pts[2], pts[3]);
+            pts += 3;
+        }
+    }
+    assert(pts == side.pts.data() + side.pts.size() - 1);
+}
+
+void StrokeOutliner::replayBackward(const Side& side, RawPath* dst)
+{
+    const Vec2D* pts = side.pts.data() + side.pts.size() - 1;
+    for (auto verb = side.verbs.rbegin(); verb != side.verbs.rend(); ++verb)
+    {
+        if (*verb == PathVerb::line)
+        {
+            dst->line(pts[-1]);
+            pts -= 1;
+        }
+        else
+        {
+            assert(*verb == PathVerb::cubic);
+            dst->cubic(pts[-1], pts[-2], pts[-3]);
+            pts -= 3;
+        }
+    }
+    assert(pts == side.pts.data());
+}
+} // namespace rive::pls
@@ -0,0 +1,117 @@
+/*
+ * Copyright 2024 Rive
+ */
+
+#pragma once
+
+#include "rive/math/mat2d.hpp"
+#include "rive/math/raw_path.hpp"
+#include "rive/shapes/paint/stroke_cap.hpp"
+#include "rive/shapes/paint/stroke_join.hpp"
+#include <vector>
+
+namespace rive::pls
+{
+// Converts strokes into filled outlines, so very thick strokes can be drawn with interior
+// triangulation instead of a large number of overlapping stroke triangles.
+//
+// The outline is meant to be filled with FillRule::nonZero. Each side of a contour is offset from
+// the centerline and the two sides are joined by caps (or, for closed contours, left as two loops
+// with opposite windings). Inner joins are routed through the join point itself, which keeps the
+// winding from cancelling out anywhere inside the stroke. Curves are linearized finely enough for
+// the given matrix and offset chord by chord, with each chord joined to the next like a polyline,
+// so this holds even where the radius is larger than the curve's radius of curvature. Round joins
+// and caps are emitted as cubic arcs so they keep smooth outerCurve patches, but the offsets of
+// curves are polylines.
+class StrokeOutliner
+{
+public:
+    // Writes the outline of 'path', stroked with the given radius, join, and cap, into 'dst'.
+    // 'matrix' only decides how finely curves get linearized.
+    void outline(const RawPath& path,
+                 const Mat2D& matrix,
+                 float radius,
+                 StrokeJoin,
+                 StrokeCap,
+                 RawPath* dst);
+
+private:
+    // Upper bound on the number of chords we offset each cubic with.
+    constexpr static float kMaxChordsPerCubic = 1024;
+
+    // A line or a convex cubic (that rotates no more than 180 degrees) from the centerline.
+    struct Segment
+    {
+        PathVerb verb;
+        Vec2D pts[4];
+        Vec2D tan0, tan1; // Normalized tangents at the beginning and end.
+        bool followsCusp; // Does this segment begin at a cusp in the previous one?
+    };
+
+    // One side of the stroke, built front to back. The first point has no verb.
+    struct Side
+    {
+        void reset(Vec2D pt)
+        {
+            pts.clear();
+            verbs.clear();
+            pts.push_back(pt);
+        }
+        void line(Vec2D pt)
+        {
+            pts.push_back(pt);
+            verbs.push_back(PathVerb::line);
+        }
+        void cubic(Vec2D c0, Vec2D c1, Vec2D pt)
+        {
+            pts.push_back(c0);
+            pts.push_back(c1);
+            pts.push_back(pt);
+            verbs.push_back(PathVerb::cubic);
+        }
+
+        std::vector<Vec2D> pts;
+        std::vector<PathVerb> verbs;
+    };
+
+    // Appends the contour's lines and cubics to m_segments, chopping cubics at inflections, cusps,
+    // and 180-degree turns. Zero-length segments are skipped.
+    void addLine(Vec2D p0, Vec2D p1);
+    void addCubic(const Vec2D pts[4]);
+
+    // Offsets m_segments into m_left and m_right, and writes the finished contour to 'dst'.
+    void outlineContour(bool closed, Vec2D contourStart, RawPath* dst);
+
+    // Joins two segments at 'pt' on both sides of the stroke.
+    void join(Vec2D pt, Vec2D tan0, Vec2D tan1, StrokeJoin);
+
+    // Offsets a segment (minus its first point) onto both sides of the stroke.
+    void offsetSegment(const Segment&);
+
+    // Picks the join between two consecutive chords of a linearized cubic.
+    StrokeJoin chordJoin(Vec2D tan0, Vec2D tan1) const;
+
+    // Adds a cap at 'pt', sweeping from pt + m_radius * normal to pt - m_radius * normal.
+    void cap(RawPath* dst, Vec2D pt, Vec2D tangent, Vec2D normal);
+
+    // Adds the stroke of a contour that has no length.
+    void emptyContour(Vec2D pt, bool closed, RawPath* dst);
+
+    // Appends a side to 'dst', either from front to back or from back to front. Does not emit the
+    // side's initial point.
+    static void replayForward(const Side&, RawPath* dst);
+    static void replayBackward(const Side&, RawPath* dst);
+
+    // Results of the current contour.
+    std::vector<Segment> m_segments;
+    Side m_left;
+    Side m_right;
+
+    // Parameters of the current outline() call.
+    float m_radius = 0;
+    float m_polarSegmentsPerRadian = 0;
+    StrokeJoin m_join = StrokeJoin::miter;
+    StrokeCap m_cap = StrokeCap::butt;
+    Mat2D m_matrix;
+};
+} // namespace rive::pls
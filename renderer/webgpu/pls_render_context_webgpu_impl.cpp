@@ -1261,9 +1261,12 @@ public:
 protected:
     void* onMapBuffer(int bufferIdx, size_t mapSizeInBytes) override { return shadowBuffer(); }
 
-    void onUnmapAndSubmitBuffer(int bufferIdx, size_t mapSizeInBytes) override
+    void onUnmapAndSubmitBuffer(int bufferIdx, size_t updateSizeInBytes) override
     {
-        write_buffer(m_queue, m_buffers[bufferIdx], shadowBuffer(), mapSizeInBytes);
+        if (updateSizeInBytes != 0)
+        {
+            write_buffer(m_queue, m_buffers[bufferIdx], shadowBuffer(), updateSizeInBytes);
+        }
     }
 
     const wgpu::Queue m_queue;
@@ -2036,8 +2039,10 @@ void PLSRenderContextWebGPUImpl::flush(const FlushDescriptor& desc)
             }
             case DrawType::interiorTriangulation:
             {
+                auto indexBuffer = static_cast<const RenderBufferWebGPUImpl*>(batch.indexBuffer);
                 drawPass.SetVertexBuffer(0, webgpu_buffer(triangleBufferRing()));
-                drawPass.Draw(batch.elementCount, 1, batch.baseElement);
+                drawPass.SetIndexBuffer(indexBuffer->submittedBuffer(), wgpu::IndexFormat::Uint32);
+                drawPass.DrawIndexed(batch.elementCount, 1, batch.baseElement);
                 break;
             }
             case DrawType::imageRect:
@@ -2047,8 +2052,12 @@ void PLSRenderContextWebGPUImpl::flush(const FlushDescriptor& desc)
                 auto vertexBuffer = static_cast<const RenderBufferWebGPUImpl*>(batch.vertexBuffer);
                 auto uvBuffer = static_cast<const RenderBufferWebGPUImpl*>(batch.uvBuffer);
                 auto indexBuffer = static_cast<const RenderBufferWebGPUImpl*>(batch.indexBuffer);
-                drawPass.SetVertexBuffer(0, vertexBuffer->submittedBuffer());
-                drawPass.SetVertexBuffer(1, uvBuffer->submittedBuffer());
+                drawPass.SetVertexBuffer(0,
+                                         vertexBuffer->submittedBuffer(),
+                                         batch.vertexDataOffsetInBytes);
+                drawPass.SetVertexBuffer(1,
+                                         uvBuffer->submittedBuffer(),
+                                         batch.vertexDataOffsetInBytes);
                 drawPass.SetIndexBuffer(indexBuffer->submittedBuffer(), wgpu::IndexFormat::Uint16);
                 drawPass.DrawIndexed(batch.elementCount, 1, batch.baseElement);
                 break;
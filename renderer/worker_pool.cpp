@@ -0,0 +1,79 @@
+/*
+ * Copyright 2024 Rive
+ */
+
+#include "worker_pool.hpp"
+
+#include <algorithm>
+#include <cassert>
+
+#if defined(__EMSCRIPTEN__) && !defined(__EMSCRIPTEN_PTHREADS__)
+#define RIVE_NO_THREADS
+#endif
+
+namespace rive::pls
+{
+WorkerPool::WorkerPool(uint32_t threadCount)
+{
+#ifndef RIVE_NO_THREADS
+    if (threadCount == 0)
+    {
+        // Leave a core for the render thread.
+        threadCount = std::clamp(std::thread::hardware_concurrency(), 2u, 5u) - 1;
+    }
+    m_threads.reserve(threadCount);
+    for (uint32_t i = 0; i < threadCount; ++i)
+    {
+        m_threads.emplace_back(&WorkerPool::workerLoop, this);
+    }
+#endif
+}
+
+WorkerPool::~WorkerPool()
+{
+    {
+        std::lock_guard lock(m_mutex);
+        m_shuttingDown = true;
+    }
+    m_jobsAvailable.notify_all();
+    for (std::thread& thread : m_threads)
+    {
+        thread.join();
+    }
+    assert(m_jobs.empty());
+}
+
+void WorkerPool::run(std::function<void()> job)
+{
+    if (m_threads.empty())
+    {
+        job();
+        return;
+    }
+    {
+        std::lock_guard lock(m_mutex);
+        assert(!m_shuttingDown);
+        m_jobs.push_back(std::move(job));
+    }
+    m_jobsAvailable.notify_one();
+}
+
+void WorkerPool::workerLoop()
+{
+    for (;;)
+    {
+        std::function<void()> job;
+        {
+            std::unique_lock lock(m_mutex);
+            m_jobsAvailable.wait(lock, [this] { return m_shuttingDown || !m_jobs.empty(); });
+            if (m_jobs.empty())
+            {
+                return; // m_shuttingDown is true and there is no more work.
+            }
+            job = std::move(m_jobs.front());
+            m_jobs.pop_front();
+        }
+        job();
+    }
+}
+} // namespace rive::pls
@@ -0,0 +1,43 @@
+/*
+ * Copyright 2024 Rive
+ */
+
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace rive::pls
+{
+// Fixed-size pool of worker threads that run CPU-only jobs (e.g., image decoding) off the render
+// thread. Jobs must not touch the GPU.
+//
+// On platforms without threads, jobs run synchronously on the calling thread.
+class WorkerPool
+{
+public:
+    // A threadCount of 0 chooses a count based on std::thread::hardware_concurrency().
+    explicit WorkerPool(uint32_t threadCount = 0);
+
+    // Blocks until every job already in the queue has finished.
+    ~WorkerPool();
+
+    WorkerPool(const WorkerPool&) = delete;
+    WorkerPool& operator=(const WorkerPool&) = delete;
+
+    void run(std::function<void()> job);
+
+private:
+    void workerLoop();
+
+    std::vector<std::thread> m_threads;
+    std::deque<std::function<void()>> m_jobs;
+    std::mutex m_mutex;
+    std::condition_variable m_jobsAvailable;
+    bool m_shuttingDown = false;
+};
+} // namespace rive::pls
@@ -0,0 +1,106 @@
+/*
+ * Copyright 2024 Rive
+ */
+
+#include "path_utils.hpp"
+
+#include <algorithm>
+#include <array>
+#include <catch.hpp>
+#include <random>
+#include <vector>
+
+namespace rive::pathutils
+{
+// Checks that FindCubicConvex180Chops4() agrees with FindCubicConvex180Chops() on every cubic in
+// 'cubics', 4 at a time. The T values may differ by float rounding.
+static void check_batched_chops(const std::vector<std::array<Vec2D, 4>>& cubics)
+{
+    for (size_t i = 0; i < cubics.size(); i += 4)
+    {
+        const Vec2D* pts[4];
+        for (size_t j = 0; j < 4; ++j)
+        {
+            // Repeat the final cubic if there aren't enough to fill the batch.
+            pts[j] = cubics[std::min(i + j, cubics.size() - 1)].data();
+        }
+        float batchT[4][2];
+        bool batchAreCusps[4];
+        int batchNumChops[4];
+        FindCubicConvex180Chops4(pts, batchT, batchAreCusps, batchNumChops);
+        for (size_t j = 0; j < 4; ++j)
+        {
+            float T[2];
+            bool areCusps;
+            int numChops = FindCubicConvex180Chops(pts[j], T, &areCusps);
+            CHECK(batchNumChops[j] == numChops);
+            if (numChops != 0)
+            {
+                CHECK(batchAreCusps[j] == areCusps);
+            }
+            for (int k = 0; k < numChops; ++k)
+            {
+                CHECK(batchT[j][k] == Approx(T[k]).margin(1.f / (1 << 10)));
+            }
+        }
+    }
+}
+
+TEST_CASE("FindCubicConvex180Chops4 matches FindCubicConvex180Chops on random cubics",
+          "[pathutils]")
+{
+    std::mt19937 rand(0);
+    std::uniform_real_distribution<float> coord(-100, 100);
+    std::vector<std::array<Vec2D, 4>> cubics;
+    for (int i = 0; i < 4000; ++i)
+    {
+        cubics.push_back({Vec2D{coord(rand), coord(rand)},
+                          Vec2D{coord(rand), coord(rand)},
+                          Vec2D{coord(rand), coord(rand)},
+                          Vec2D{coord(rand), coord(rand)}});
+    }
+    check_batched_chops(cubics);
+}
+
+TEST_CASE("FindCubicConvex180Chops4 matches FindCubicConvex180Chops on degenerate cubics",
+          "[pathutils]")
+{
+    std::vector<std::array<Vec2D, 4>> cubics = {
+        // Cusps.
+        {Vec2D{0, 0}, Vec2D{100, 100}, Vec2D{0, 100}, Vec2D{100, 0}},
+        {Vec2D{0, 0}, Vec2D{200, 0}, Vec2D{-100, 0}, Vec2D{100, 0}},
+        {Vec2D{10, 10}, Vec2D{60, -40}, Vec2D{-40, -40}, Vec2D{10, 10}},
+        // Loops.
+        {Vec2D{0, 0}, Vec2D{200, 200}, Vec2D{-100, 200}, Vec2D{100, 0}},
+        {Vec2D{0, 0}, Vec2D{100, 100}, Vec2D{100, -100}, Vec2D{0, 0}},
+        // Serpentines.
+        {Vec2D{0, 0}, Vec2D{100, 100}, Vec2D{0, 100}, Vec2D{100, 200}},
+        // Flat lines, including ones that turn around 1 or 2 times.
+        {Vec2D{0, 0}, Vec2D{1, 1}, Vec2D{2, 2}, Vec2D{3, 3}},
+        {Vec2D{0, 0}, Vec2D{10, 0}, Vec2D{-5, 0}, Vec2D{5, 0}},
+        {Vec2D{0, 0}, Vec2D{-10, -10}, Vec2D{20, 20}, Vec2D{5, 5}},
+        {Vec2D{0, 0}, Vec2D{0, 10}, Vec2D{0, 10}, Vec2D{0, 0}},
+        // Coincident control points.
+        {Vec2D{0, 0}, Vec2D{0, 0}, Vec2D{100, 100}, Vec2D{100, 0}},
+        {Vec2D{0, 0}, Vec2D{100, 100}, Vec2D{100, 100}, Vec2D{100, 0}},
+        {Vec2D{0, 0}, Vec2D{100, 100}, Vec2D{100, 0}, Vec2D{100, 0}},
+        {Vec2D{5, 5}, Vec2D{5, 5}, Vec2D{5, 5}, Vec2D{5, 5}},
+        // Nearly-degenerate cusps.
+        {Vec2D{0, 0}, Vec2D{100, 100.001f}, Vec2D{0, 100}, Vec2D{100, 0}},
+        {Vec2D{0, 0}, Vec2D{200, 1e-3f}, Vec2D{-100, 0}, Vec2D{100, 0}},
+    };
+    check_batched_chops(cubics);
+
+    // Also mix each degenerate cubic into batches with every other one, so every cubic gets
+    // evaluated in every lane.
+    std::vector<std::array<Vec2D, 4>> shuffled;
+    for (size_t i = 0; i < cubics.size(); ++i)
+    {
+        for (size_t j = 0; j < cubics.size(); ++j)
+        {
+            shuffled.push_back(cubics[(i + j) % cubics.size()]);
+        }
+    }
+    check_batched_chops(shuffled);
+}
+} // namespace rive::pathutils
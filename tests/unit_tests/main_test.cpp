@@ -0,0 +1,6 @@
+/*
+ * Copyright 2024 Rive
+ */
+
+#define CATCH_CONFIG_MAIN
+#include <catch.hpp>
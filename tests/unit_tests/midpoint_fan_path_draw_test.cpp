@@ -0,0 +1,182 @@
+/*
+ * Copyright 2024 Rive
+ */
+
+#include "pls_render_context_null.hpp"
+#include "pls_paint.hpp"
+#include "pls_path.hpp"
+#include "rive/pls/pls_draw.hpp"
+#include <catch.hpp>
+
+namespace rive::pls
+{
+// Begins a frame on a CPU-only context, and flushes it when the test is done.
+class TestFrame
+{
+public:
+    TestFrame(uint32_t width, uint32_t height) :
+        m_context(PLSRenderContextNULLImpl::MakeContext()),
+        m_renderTarget(make_rcp<PLSRenderTargetNULL>(width, height))
+    {
+        PLSRenderContext::FrameDescriptor frameDescriptor;
+        frameDescriptor.renderTargetWidth = width;
+        frameDescriptor.renderTargetHeight = height;
+        m_context->beginFrame(frameDescriptor);
+    }
+
+    ~TestFrame() { m_context->flush({m_renderTarget.get()}); }
+
+    // Returns the resources that drawing 'path' with 'paint' would reserve.
+    PLSDraw::ResourceCounters countResources(rcp<PLSPath> path,
+                                             const PLSPaint& paint,
+                                             const Mat2D& matrix = Mat2D())
+    {
+        FillRule fillRule = path->getFillRule();
+        PLSDrawUniquePtr draw = PLSPathDraw::Make(m_context.get(),
+                                                  matrix,
+                                                  std::move(path),
+                                                  fillRule,
+                                                  &paint,
+                                                  &m_scratchPath);
+        return draw->resourceCounts();
+    }
+
+private:
+    std::unique_ptr<PLSRenderContext> m_context;
+    rcp<PLSRenderTargetNULL> m_renderTarget;
+    RawPath m_scratchPath;
+};
+
+static void add_rect(PLSPath* path, float l, float t, float r, float b)
+{
+    path->moveTo(l, t);
+    path->lineTo(r, t);
+    path->lineTo(r, b);
+    path->lineTo(l, b);
+    path->close();
+}
+
+TEST_CASE("many-tiny-contours-are-not-culled", "[MidpointFanPathDraw]")
+{
+    TestFrame frame(256, 256);
+    PLSPaint fill;
+
+    // Each contour is sub-pixel, but together they span most of the render target.
+    auto dots = make_rcp<PLSPath>();
+    for (int y = 0; y < 16; ++y)
+    {
+        for (int x = 0; x < 16; ++x)
+        {
+            add_rect(dots.get(), x * 16.f, y * 16.f, x * 16.f + .1f, y * 16.f + .1f);
+        }
+    }
+    auto counts = frame.countResources(dots, fill);
+    CHECK(counts.contourCount == 16 * 16);
+    CHECK(counts.midpointFanTessVertexCount > 0);
+
+    // A path that is sub-pixel as a whole gets culled.
+    auto speck = make_rcp<PLSPath>();
+    for (int i = 0; i < 16; ++i)
+    {
+        add_rect(speck.get(), 10 + i * .005f, 10, 10 + i * .005f + .01f, 10.01f);
+    }
+    counts = frame.countResources(speck, fill);
+    CHECK(counts.contourCount == 0);
+    CHECK(counts.midpointFanTessVertexCount == 0);
+
+    // The same path scaled up to be visible does not.
+    counts = frame.countResources(speck, fill, Mat2D(100, 0, 0, 100, -990, -990));
+    CHECK(counts.contourCount == 16);
+    CHECK(counts.midpointFanTessVertexCount > 0);
+}
+
+// S-shaped contour of cubics that each need a convex-180 chop at their inflection.
+static void add_squiggle(PLSPath* path, float x, float y, int cubicCount)
+{
+    path->moveTo(x, y);
+    for (int i = 0; i < cubicCount; ++i, x += 40)
+    {
+        path->cubicTo(x + 40, y, x, y + 40, x + 40, y + 40);
+    }
+}
+
+TEST_CASE("culled-stroke-contour-between-onscreen-contours", "[MidpointFanPathDraw]")
+{
+    TestFrame frame(256, 256);
+    PLSPaint stroke;
+    stroke.style(RenderPaintStyle::stroke);
+    stroke.thickness(4);
+
+    auto onscreenOnly = make_rcp<PLSPath>();
+    add_squiggle(onscreenOnly.get(), 10, 10, 1);
+    add_squiggle(onscreenOnly.get(), 10, 100, 3);
+    auto expected = frame.countResources(onscreenOnly, stroke);
+    REQUIRE(expected.contourCount == 2);
+
+    // The first contour's chop batch looks ahead into the offscreen contour, which gets culled.
+    // The final contour must still pick up its own chops.
+    auto withOffscreen = make_rcp<PLSPath>();
+    add_squiggle(withOffscreen.get(), 10, 10, 1);
+    add_squiggle(withOffscreen.get(), -1000, 10, 3);
+    add_squiggle(withOffscreen.get(), 10, 100, 3);
+    auto counts = frame.countResources(withOffscreen, stroke);
+    CHECK(counts.contourCount == expected.contourCount);
+    CHECK(counts.maxTessellatedSegmentCount == expected.maxTessellatedSegmentCount);
+    CHECK(counts.midpointFanTessVertexCount == expected.midpointFanTessVertexCount);
+}
+
+TEST_CASE("hairline-dots-keep-their-caps", "[MidpointFanPathDraw]")
+{
+    TestFrame frame(256, 256);
+    auto dot = make_rcp<PLSPath>();
+    dot->moveTo(50, 50);
+    dot->close();
+
+    // Closed, empty contours get round caps from round joins and square caps from miter joins.
+    // This still has to be true when the stroke is thin enough to draw as a hairline.
+    for (float thickness : {4.f, 1.f, .25f})
+    {
+        PLSPaint stroke;
+        stroke.style(RenderPaintStyle::stroke);
+        stroke.thickness(thickness);
+        stroke.join(StrokeJoin::round);
+        CHECK(frame.countResources(dot, stroke).midpointFanTessVertexCount > 0);
+        stroke.join(StrokeJoin::miter);
+        CHECK(frame.countResources(dot, stroke).midpointFanTessVertexCount > 0);
+        // Bevel joins converge to nothing.
+        stroke.join(StrokeJoin::bevel);
+        CHECK(frame.countResources(dot, stroke).midpointFanTessVertexCount == 0);
+    }
+}
+
+TEST_CASE("hairlines-keep-caps-and-miters", "[MidpointFanPathDraw]")
+{
+    TestFrame frame(256, 256);
+    auto zigzag = make_rcp<PLSPath>();
+    zigzag->moveTo(10, 10);
+    zigzag->lineTo(100, 20);
+    zigzag->lineTo(10, 30);
+    zigzag->lineTo(100, 40);
+
+    PLSPaint stroke;
+    stroke.style(RenderPaintStyle::stroke);
+    stroke.join(StrokeJoin::miter);
+    stroke.cap(StrokeCap::square);
+
+    // Lines don't have polar segments, so miter joins and caps tessellate the same at every width.
+    // This includes hairlines, which are no wider than half a pixel.
+    stroke.thickness(4);
+    auto wide = frame.countResources(zigzag, stroke);
+    stroke.thickness(.5f);
+    auto hairline = frame.countResources(zigzag, stroke);
+    CHECK(hairline.midpointFanTessVertexCount == wide.midpointFanTessVertexCount);
+
+    // The caps are still emitted.
+    CHECK(hairline.maxTessellatedSegmentCount == wide.maxTessellatedSegmentCount);
+
+    // Hairlines emit round joins as bevels, so they don't measure polar segments for joins.
+    stroke.join(StrokeJoin::round);
+    CHECK(frame.countResources(zigzag, stroke).midpointFanTessVertexCount ==
+          hairline.midpointFanTessVertexCount);
+}
+} // namespace rive::pls
@@ -0,0 +1,179 @@
+/*
+ * Copyright 2024 Rive
+ */
+
+#include "dash_path.hpp"
+#include <catch.hpp>
+#include <limits>
+#include <vector>
+
+namespace rive::pls
+{
+// Returns the [start, end] x coordinates of each dash along a horizontal line.
+static std::vector<std::pair<float, float>> dash_extents(const RawPath& dashes)
+{
+    std::vector<std::pair<float, float>> extents;
+    for (auto [verb, pts] : dashes)
+    {
+        switch (verb)
+        {
+            case PathVerb::move:
+                extents.push_back({pts[0].x, pts[0].x});
+                break;
+            case PathVerb::line:
+                extents.back().second = pts[1].x;
+                break;
+            case PathVerb::cubic:
+                extents.back().second = pts[3].x;
+                break;
+            default:
+                break;
+        }
+    }
+    return extents;
+}
+
+static void check_extent(std::pair<float, float> extent, float start, float end)
+{
+    CHECK(extent.first == Approx(start));
+    CHECK(extent.second == Approx(end));
+}
+
+static RawPath horizontal_line(float length)
+{
+    RawPath line;
+    line.move({0, 0});
+    line.line({length, 0});
+    return line;
+}
+
+TEST_CASE("dashes-follow-the-intervals", "[PathDasher]")
+{
+    PathDasher dasher;
+    RawPath dashes;
+    const float intervals[] = {10, 5};
+    REQUIRE(dasher.dash(horizontal_line(40), Mat2D(), intervals, 2, 0, &dashes));
+    auto extents = dash_extents(dashes);
+    REQUIRE(extents.size() == 3);
+    check_extent(extents[0], 0.f, 10.f);
+    check_extent(extents[1], 15.f, 25.f);
+    check_extent(extents[2], 30.f, 40.f);
+}
+
+TEST_CASE("dash-phase-wraps", "[PathDasher]")
+{
+    PathDasher dasher;
+    RawPath dashes;
+    const float intervals[] = {10, 10};
+    RawPath line = horizontal_line(50);
+
+    // A phase of 5 starts halfway through the first dash.
+    REQUIRE(dasher.dash(line, Mat2D(), intervals, 2, 5, &dashes));
+    auto expected = dash_extents(dashes);
+    REQUIRE(expected.size() == 3);
+    check_extent(expected[0], 0.f, 5.f);
+    check_extent(expected[1], 15.f, 25.f);
+    check_extent(expected[2], 35.f, 45.f);
+
+    // Phases a whole pattern away (in either direction) are equivalent.
+    for (float phase : {25.f, 45.f, -15.f, -35.f})
+    {
+        REQUIRE(dasher.dash(line, Mat2D(), intervals, 2, phase, &dashes));
+        CHECK(dash_extents(dashes) == expected);
+    }
+
+    // A phase that lands in a gap starts the contour in that gap.
+    REQUIRE(dasher.dash(line, Mat2D(), intervals, 2, 15, &dashes));
+    auto extents = dash_extents(dashes);
+    REQUIRE(extents.size() == 3);
+    check_extent(extents[0], 5.f, 15.f);
+    check_extent(extents[2], 45.f, 50.f);
+}
+
+TEST_CASE("odd-dash-interval-counts-repeat-twice", "[PathDasher]")
+{
+    PathDasher dasher;
+    RawPath dashes;
+
+    // {10} means 10 on, 10 off.
+    const float single[] = {10};
+    REQUIRE(dasher.dash(horizontal_line(40), Mat2D(), single, 1, 0, &dashes));
+    auto extents = dash_extents(dashes);
+    REQUIRE(extents.size() == 2);
+    check_extent(extents[0], 0.f, 10.f);
+    check_extent(extents[1], 20.f, 30.f);
+
+    // {10, 5, 5} means 10 on, 5 off, 5 on, 10 off, 5 on, 5 off.
+    const float triple[] = {10, 5, 5};
+    REQUIRE(dasher.dash(horizontal_line(40), Mat2D(), triple, 3, 0, &dashes));
+    extents = dash_extents(dashes);
+    REQUIRE(extents.size() == 3);
+    check_extent(extents[0], 0.f, 10.f);
+    check_extent(extents[1], 15.f, 20.f);
+    check_extent(extents[2], 30.f, 35.f);
+}
+
+TEST_CASE("zero-length-dashes-become-dots", "[PathDasher]")
+{
+    PathDasher dasher;
+    RawPath dashes;
+    const float intervals[] = {0, 10};
+    REQUIRE(dasher.dash(horizontal_line(40), Mat2D(), intervals, 2, 0, &dashes));
+
+    // Each dot is a lone move, so it still gets caps. The final dot lands on the endpoint.
+    auto extents = dash_extents(dashes);
+    REQUIRE(extents.size() == 5);
+    for (size_t i = 0; i < extents.size(); ++i)
+    {
+        check_extent(extents[i], i * 10.f, i * 10.f);
+    }
+    for (auto [verb, pts] : dashes)
+    {
+        CHECK(verb == PathVerb::move);
+    }
+
+    // The pattern restarts on every contour, including a closed one.
+    RawPath square;
+    square.move({0, 0});
+    square.line({20, 0});
+    square.line({20, 20});
+    square.line({0, 20});
+    square.close();
+    square.move({100, 0});
+    square.line({120, 0});
+    REQUIRE(dasher.dash(square, Mat2D(), intervals, 2, 0, &dashes));
+    size_t dotCount = 0;
+    for (auto [verb, pts] : dashes)
+    {
+        dotCount += verb == PathVerb::move;
+    }
+    CHECK(dotCount == 9 + 3);
+}
+
+TEST_CASE("dashes-fall-back-to-solid-strokes", "[PathDasher]")
+{
+    PathDasher dasher;
+    RawPath dashes;
+    RawPath line = horizontal_line(1000);
+
+    // 50k dashes are still fine.
+    const float small[] = {.01f, .01f};
+    CHECK(dasher.dash(line, Mat2D(), small, 2, 0, &dashes));
+    CHECK(!dashes.empty());
+
+    // More than 100k fall back, and leave the destination empty.
+    const float tiny[] = {.001f, .001f};
+    CHECK(!dasher.dash(line, Mat2D(), tiny, 2, 0, &dashes));
+    CHECK(dashes.empty());
+
+    // So do invalid patterns.
+    const float zeros[] = {0, 0};
+    CHECK(!dasher.dash(line, Mat2D(), zeros, 2, 0, &dashes));
+    const float negative[] = {10, -5};
+    CHECK(!dasher.dash(line, Mat2D(), negative, 2, 0, &dashes));
+    const float nan[] = {10, std::numeric_limits<float>::quiet_NaN()};
+    CHECK(!dasher.dash(line, Mat2D(), nan, 2, 0, &dashes));
+    CHECK(!dasher.dash(line, Mat2D(), nullptr, 0, 0, &dashes));
+    CHECK(dashes.empty());
+}
+} // namespace rive::pls
@@ -0,0 +1,52 @@
+/*
+ * Copyright 2024 Rive
+ */
+
+#include "pls_path.hpp"
+#include "rive/math/wangs_formula.hpp"
+#include "rive/pls/pls.hpp"
+#include <catch.hpp>
+
+namespace rive::pls
+{
+TEST_CASE("cubic-segment-counts-only-cache-reused-matrices", "[PLSPath]")
+{
+    PLSPath path;
+    path.moveTo(0, 0);
+    path.cubicTo(100, 0, 0, 100, 100, 100);
+    path.lineTo(0, 100);
+    path.cubicTo(-50, 50, 50, 50, 0, 0);
+
+    // The first draw with a new 2x2 doesn't cache anything.
+    CHECK(path.getCubicParametricSegmentCountsP4(Mat2D(2, .5f, -.25f, 3, 10, 20)) == nullptr);
+
+    // The second one does. Translation doesn't matter.
+    Mat2D matrix(2, .5f, -.25f, 3, -1000, 20);
+    const float* countsP4 = path.getCubicParametricSegmentCountsP4(matrix);
+    REQUIRE(countsP4 != nullptr);
+    wangs_formula::VectorXform vectorXform(matrix);
+    size_t cubicIdx = 0;
+    for (auto [verb, pts] : path.getRawPath())
+    {
+        if (verb == PathVerb::cubic)
+        {
+            CHECK(countsP4[cubicIdx++] ==
+                  wangs_formula::cubic_pow4(pts, kParametricPrecision, vectorXform));
+        }
+    }
+    CHECK(cubicIdx == 2);
+    CHECK(path.getCubicParametricSegmentCountsP4(matrix) == countsP4);
+
+    // A matrix that keeps changing never gets cached.
+    for (int i = 1; i <= 3; ++i)
+    {
+        CHECK(path.getCubicParametricSegmentCountsP4(Mat2D::fromRotation(i * .1f)) == nullptr);
+    }
+
+    // Neither does a path that keeps changing.
+    CHECK(path.getCubicParametricSegmentCountsP4(matrix) == nullptr);
+    path.lineTo(50, 50);
+    CHECK(path.getCubicParametricSegmentCountsP4(matrix) == nullptr);
+    CHECK(path.getCubicParametricSegmentCountsP4(matrix) != nullptr);
+}
+} // namespace rive::pls
@@ -0,0 +1,68 @@
+/*
+ * Copyright 2024 Rive
+ */
+
+#pragma once
+
+#include "rive/pls/pls_render_context_helper_impl.hpp"
+#include "rive/pls/pls_render_target.hpp"
+
+namespace rive::pls
+{
+// CPU-only PLSRenderContextImpl for unit tests. Buffers live in heap memory and flushes are
+// dropped, so tests can exercise everything PLSRenderContext does on the CPU without a GPU.
+class PLSRenderContextNULLImpl : public PLSRenderContextHelperImpl
+{
+public:
+    static std::unique_ptr<PLSRenderContext> MakeContext()
+    {
+        return std::make_unique<PLSRenderContext>(std::make_unique<PLSRenderContextNULLImpl>());
+    }
+
+    rcp<RenderBuffer> makeRenderBuffer(RenderBufferType, RenderBufferFlags, size_t) override
+    {
+        return nullptr;
+    }
+
+    void resizeGradientTexture(uint32_t width, uint32_t height) override {}
+    void resizeTessellationTexture(uint32_t width, uint32_t height) override {}
+
+    void flush(const FlushDescriptor&) override {}
+
+protected:
+    rcp<PLSTexture> makeImageTexture(uint32_t width,
+                                     uint32_t height,
+                                     uint32_t mipLevelCount,
+                                     const uint8_t imageDataRGBA[]) override
+    {
+        return nullptr;
+    }
+
+    std::unique_ptr<BufferRing> makeUniformBufferRing(size_t capacityInBytes) override
+    {
+        return std::make_unique<HeapBufferRing>(capacityInBytes);
+    }
+
+    std::unique_ptr<BufferRing> makeStorageBufferRing(size_t capacityInBytes,
+                                                      pls::StorageBufferStructure) override
+    {
+        return std::make_unique<HeapBufferRing>(capacityInBytes);
+    }
+
+    std::unique_ptr<BufferRing> makeVertexBufferRing(size_t capacityInBytes) override
+    {
+        return std::make_unique<HeapBufferRing>(capacityInBytes);
+    }
+
+    std::unique_ptr<BufferRing> makeTextureTransferBufferRing(size_t capacityInBytes) override
+    {
+        return std::make_unique<HeapBufferRing>(capacityInBytes);
+    }
+};
+
+class PLSRenderTargetNULL : public PLSRenderTarget
+{
+public:
+    PLSRenderTargetNULL(uint32_t width, uint32_t height) : PLSRenderTarget(width, height) {}
+};
+} // namespace rive::pls
@@ -0,0 +1,162 @@
+/*
+ * Copyright 2024 Rive
+ */
+
+#include "pls_render_context_null.hpp"
+#include "pls_paint.hpp"
+#include "pls_path.hpp"
+#include "rive/math/math_types.hpp"
+#include "rive/pls/pls_draw.hpp"
+#include <catch.hpp>
+
+namespace rive::pls
+{
+TEST_CASE("adaptive-interior-triangulation-recovers", "[PLSRenderContext]")
+{
+    auto context = PLSRenderContextNULLImpl::MakeContext();
+    auto renderTarget = make_rcp<PLSRenderTargetNULL>(100, 100);
+    PLSRenderContext::FrameDescriptor frameDescriptor;
+    frameDescriptor.renderTargetWidth = renderTarget->width();
+    frameDescriptor.renderTargetHeight = renderTarget->height();
+    frameDescriptor.adaptiveInteriorTriangulation = true;
+    constexpr static float kLargeArea = 1000 * 1000;
+    constexpr static size_t kPointCount = 100;
+
+    context->beginFrame(frameDescriptor);
+    CHECK(context->shouldTriangulateInterior(kLargeArea, kPointCount));
+    // Tiny paths always use a midpoint fan.
+    CHECK(!context->shouldTriangulateInterior(100 * 100, 1));
+    // A triangulation that hit a hiccup makes triangulating look too expensive.
+    context->recordInteriorTriangulationTime(1, kPointCount);
+    CHECK(!context->shouldTriangulateInterior(kLargeArea, kPointCount));
+    context->flush({renderTarget.get()});
+
+    // Without any more triangulations to measure, the estimate eventually recovers.
+    int framesUntilRecovered = 0;
+    for (; framesUntilRecovered < 10000; ++framesUntilRecovered)
+    {
+        context->beginFrame(frameDescriptor);
+        bool recovered = context->shouldTriangulateInterior(kLargeArea, kPointCount);
+        context->flush({renderTarget.get()});
+        if (recovered)
+        {
+            break;
+        }
+    }
+    CHECK(framesUntilRecovered > 1);
+    CHECK(framesUntilRecovered < 10000);
+}
+
+TEST_CASE("pending-triangulations-reserve-grout", "[PLSRenderContext]")
+{
+    auto context = PLSRenderContextNULLImpl::MakeContext();
+    auto renderTarget = make_rcp<PLSRenderTargetNULL>(1000, 1000);
+    PLSRenderContext::FrameDescriptor frameDescriptor;
+    frameDescriptor.renderTargetWidth = renderTarget->width();
+    frameDescriptor.renderTargetHeight = renderTarget->height();
+    context->beginFrame(frameDescriptor);
+
+    // A large, concave star, so it can't take the convex fan shortcut.
+    auto star = make_rcp<PLSPath>();
+    star->moveTo(500, 0);
+    for (int i = 1; i < 10; ++i)
+    {
+        float radius = (i & 1) ? 200 : 500;
+        float theta = i * math::PI / 5;
+        star->lineTo(500 + sinf(theta) * radius, 500 - cosf(theta) * radius);
+    }
+    star->close();
+    PLSPaint fill;
+    RawPath scratchPath;
+    PLSDrawUniquePtr draw =
+        PLSPathDraw::Make(context.get(), Mat2D(), star, FillRule::nonZero, &fill, &scratchPath);
+    REQUIRE(draw->type() == PLSDraw::Type::interiorTriangulationPath);
+    auto* triangulation = static_cast<InteriorTriangulationDraw*>(draw.get());
+    REQUIRE(triangulation->hasPendingTriangulation());
+
+    // While the worker thread runs, the draw reserves room for a midpoint fan of the same path.
+    PLSDraw::ResourceCounters pendingCounts = draw->resourceCounts();
+    PLSDrawUniquePtr midpointFan(context->make<MidpointFanPathDraw>(context.get(),
+                                                                    draw->pixelBounds(),
+                                                                    Mat2D(),
+                                                                    star,
+                                                                    FillRule::nonZero,
+                                                                    &fill,
+                                                                    false));
+    CHECK(midpointFan->resourceCounts().midpointFanTessVertexCount <=
+          pendingCounts.midpointFanTessVertexCount + pendingCounts.outerCubicTessVertexCount);
+    CHECK(midpointFan->resourceCounts().contourCount <= pendingCounts.contourCount);
+    midpointFan.reset();
+
+    // Its actual grout fits within the reservation too.
+    triangulation->resolvePendingTriangulation(context.get());
+    CHECK(!triangulation->overranReservation());
+    CHECK(draw->resourceCounts().outerCubicTessVertexCount <=
+          pendingCounts.outerCubicTessVertexCount);
+    CHECK(draw->resourceCounts().maxTessellatedSegmentCount <=
+          pendingCounts.maxTessellatedSegmentCount);
+    CHECK(draw->resourceCounts().maxTriangleIndexCount > 0);
+
+    draw.reset();
+    context->flush({renderTarget.get()});
+}
+
+TEST_CASE("depth-stencil-triangulations-are-flattened", "[PLSRenderContext]")
+{
+    auto context = PLSRenderContextNULLImpl::MakeContext();
+    auto renderTarget = make_rcp<PLSRenderTargetNULL>(1000, 1000);
+    PLSRenderContext::FrameDescriptor frameDescriptor;
+    frameDescriptor.renderTargetWidth = renderTarget->width();
+    frameDescriptor.renderTargetHeight = renderTarget->height();
+    frameDescriptor.msaaSampleCount = 4; // Forces depthStencil mode.
+
+    // A large, concave star with curved edges.
+    auto star = make_rcp<PLSPath>();
+    Vec2D p0 = {500, 0};
+    star->moveTo(p0.x, p0.y);
+    for (int i = 1; i <= 10; ++i)
+    {
+        float radius = (i & 1) ? 200 : 500;
+        float theta = i * math::PI / 5;
+        Vec2D p1 = {500 + sinf(theta) * radius, 500 - cosf(theta) * radius};
+        Vec2D bulge = Vec2D(p1.y - p0.y, p0.x - p1.x) * .2f;
+        Vec2D c0 = p0 + (p1 - p0) * (1 / 3.f) + bulge;
+        Vec2D c1 = p0 + (p1 - p0) * (2 / 3.f) + bulge;
+        star->cubicTo(c0.x, c0.y, c1.x, c1.y, p1.x, p1.y);
+        p0 = p1;
+    }
+    star->close();
+    PLSPaint fill;
+    RawPath scratchPath;
+
+    for (bool synchronous : {true, false})
+    {
+        frameDescriptor.synchronousInteriorTriangulation = synchronous;
+        context->beginFrame(frameDescriptor);
+        REQUIRE(context->frameInterlockMode() == pls::InterlockMode::depthStencil);
+        PLSDrawUniquePtr draw =
+            PLSPathDraw::Make(context.get(), Mat2D(), star, FillRule::nonZero, &fill, &scratchPath);
+        REQUIRE(draw->type() == PLSDraw::Type::interiorTriangulationPath);
+        auto* triangulation = static_cast<InteriorTriangulationDraw*>(draw.get());
+        CHECK(triangulation->isFlattenedTriangulation());
+        CHECK(triangulation->hasPendingTriangulation() == !synchronous);
+        if (triangulation->hasPendingTriangulation())
+        {
+            // Flattened triangulations don't have grout, so they don't reserve any patches.
+            CHECK(draw->resourceCounts().outerCubicTessVertexCount == 0);
+            triangulation->resolvePendingTriangulation(context.get());
+        }
+
+        // The triangulator (and its timing) sees every point the cubics were flattened into.
+        CHECK(triangulation->triangulatedPointCount() > star->getRawPath().points().size());
+
+        // The flattened triangles cover the whole path, so there are no patches or grout.
+        CHECK(draw->resourceCounts().outerCubicTessVertexCount == 0);
+        CHECK(draw->resourceCounts().maxTessellatedSegmentCount == 0);
+        CHECK(draw->resourceCounts().maxTriangleIndexCount > 0);
+
+        draw.reset();
+        context->flush({renderTarget.get()});
+    }
+}
+} // namespace rive::pls
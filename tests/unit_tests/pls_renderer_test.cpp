@@ -0,0 +1,71 @@
+/*
+ * Copyright 2024 Rive
+ */
+
+#include "pls_path.hpp"
+#include "rive/pls/pls_renderer.hpp"
+#include <catch.hpp>
+#include <vector>
+
+namespace rive::pls
+{
+static rcp<PLSPath> make_rect(float l, float t, float r, float b, FillRule fillRule)
+{
+    auto path = make_rcp<PLSPath>();
+    path->fillRule(fillRule);
+    path->moveTo(l, t);
+    path->lineTo(r, t);
+    path->lineTo(r, b);
+    path->lineTo(l, b);
+    path->close();
+    return path;
+}
+
+TEST_CASE("draw-paths-merge-rules", "[PLSRenderer]")
+{
+    auto a = make_rect(0, 0, 10, 10, FillRule::nonZero);
+    auto b = make_rect(20, 0, 30, 10, FillRule::nonZero);
+    auto overlapping = make_rect(5, 5, 15, 15, FillRule::nonZero);
+    // Same bounds as 'b', wound the other way.
+    auto reversed = make_rect(30, 0, 20, 10, FillRule::nonZero);
+    auto evenOdd = make_rect(20, 0, 30, 10, FillRule::evenOdd);
+
+    RenderPath* disjoint[] = {a.get(), b.get()};
+    RenderPath* overlap[] = {a.get(), overlapping.get()};
+    RenderPath* mixedRules[] = {a.get(), evenOdd.get()};
+    RenderPath* mixedWinding[] = {a.get(), reversed.get()};
+
+    // Fills merge when their bounds are disjoint, regardless of winding.
+    CHECK(PLSRenderer::canMergePaths(disjoint, nullptr, 2, false));
+    CHECK(PLSRenderer::canMergePaths(mixedWinding, nullptr, 2, false));
+    // Overlapping fills would add up their windings, so they don't merge, even with nonZero.
+    CHECK(!PLSRenderer::canMergePaths(overlap, nullptr, 2, false));
+    CHECK(!PLSRenderer::canMergePaths(mixedRules, nullptr, 2, false));
+
+    // The per-path matrices decide where the bounds land.
+    Mat2D apart[] = {Mat2D(), Mat2D::fromTranslate(100, 100)};
+    CHECK(PLSRenderer::canMergePaths(overlap, apart, 2, false));
+    Mat2D together[] = {Mat2D(), Mat2D::fromTranslate(-20, 0)};
+    CHECK(!PLSRenderer::canMergePaths(disjoint, together, 2, false));
+
+    // Strokes may overlap, but they only merge if their matrices don't change the stroke width.
+    CHECK(PLSRenderer::canMergePaths(overlap, nullptr, 2, true));
+    CHECK(PLSRenderer::canMergePaths(overlap, apart, 2, true));
+    Mat2D scaled[] = {Mat2D(), Mat2D::fromScale(2, 2)};
+    CHECK(!PLSRenderer::canMergePaths(disjoint, scaled, 2, true));
+    Mat2D rotated[] = {Mat2D::fromRotation(1), Mat2D()};
+    CHECK(!PLSRenderer::canMergePaths(disjoint, rotated, 2, true));
+
+    // Large batches of fills aren't checked for overlap.
+    std::vector<rcp<PLSPath>> grid;
+    std::vector<RenderPath*> gridPaths;
+    for (int i = 0; i < 33; ++i)
+    {
+        grid.push_back(make_rect(i * 20.f, 0, i * 20.f + 10, 10, FillRule::nonZero));
+        gridPaths.push_back(grid.back().get());
+    }
+    CHECK(PLSRenderer::canMergePaths(gridPaths.data(), nullptr, 32, false));
+    CHECK(!PLSRenderer::canMergePaths(gridPaths.data(), nullptr, 33, false));
+    CHECK(PLSRenderer::canMergePaths(gridPaths.data(), nullptr, 33, true));
+}
+} // namespace rive::pls
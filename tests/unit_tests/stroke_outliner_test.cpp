@@ -0,0 +1,190 @@
+/*
+ * Copyright 2024 Rive
+ */
+
+#include "stroke_outline.hpp"
+#include <catch.hpp>
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+namespace rive::pls
+{
+// Flattens a path into closed polygons, one per contour.
+static std::vector<std::vector<Vec2D>> flatten(const RawPath& path)
+{
+    constexpr static int kPointsPerCubic = 64;
+    std::vector<std::vector<Vec2D>> polygons;
+    for (auto [verb, pts] : path)
+    {
+        switch (verb)
+        {
+            case PathVerb::move:
+                polygons.push_back({pts[0]});
+                break;
+            case PathVerb::line:
+                polygons.back().push_back(pts[1]);
+                break;
+            case PathVerb::cubic:
+                for (int i = 1; i <= kPointsPerCubic; ++i)
+                {
+                    float t = static_cast<float>(i) / kPointsPerCubic, u = 1 - t;
+                    polygons.back().push_back(pts[0] * (u * u * u) + pts[1] * (3 * u * u * t) +
+                                              pts[2] * (3 * u * t * t) + pts[3] * (t * t * t));
+                }
+                break;
+            default:
+                break;
+        }
+    }
+    return polygons;
+}
+
+static int winding_number(const std::vector<std::vector<Vec2D>>& polygons, Vec2D pt)
+{
+    int winding = 0;
+    for (const auto& polygon : polygons)
+    {
+        for (size_t i = 0; i < polygon.size(); ++i)
+        {
+            Vec2D a = polygon[i], b = polygon[(i + 1) % polygon.size()];
+            if (a.y <= pt.y && b.y > pt.y && Vec2D::cross(b - a, pt - a) > 0)
+            {
+                ++winding;
+            }
+            else if (a.y > pt.y && b.y <= pt.y && Vec2D::cross(b - a, pt - a) < 0)
+            {
+                --winding;
+            }
+        }
+    }
+    return winding;
+}
+
+// Outlines 'path' and checks that every pixel center in [-size, size]^2 has a nonzero winding
+// number if and only if 'isInside' says it should. Pixels within half a pixel of the edge are
+// skipped. Also checks that the outline never winds in both directions, which would let
+// overlapping parts of it cancel each other out.
+template <typename IsInside>
+static void check_outline(const RawPath& path,
+                          float radius,
+                          StrokeJoin join,
+                          StrokeCap cap,
+                          int size,
+                          IsInside&& isInside)
+{
+    StrokeOutliner outliner;
+    RawPath outline;
+    outliner.outline(path, Mat2D(), radius, join, cap, &outline);
+    auto polygons = flatten(outline);
+    int minWinding = 0, maxWinding = 0;
+    for (int y = -size; y < size; ++y)
+    {
+        for (int x = -size; x < size; ++x)
+        {
+            Vec2D pt = {x + .5f, y + .5f};
+            int winding = winding_number(polygons, pt);
+            minWinding = std::min(minWinding, winding);
+            maxWinding = std::max(maxWinding, winding);
+            if (isInside(pt, -.5f))
+            {
+                CHECK(winding != 0);
+            }
+            else if (!isInside(pt, .5f))
+            {
+                CHECK(winding == 0);
+            }
+        }
+    }
+    CHECK((minWinding == 0 || maxWinding == 0));
+}
+
+// Returns the distance from 'pt' to the nearest edge of the given polylines.
+static float distance_to(const std::vector<std::vector<Vec2D>>& polylines, Vec2D pt)
+{
+    float distance = std::numeric_limits<float>::infinity();
+    for (const auto& polyline : polylines)
+    {
+        for (size_t i = 0; i + 1 < polyline.size(); ++i)
+        {
+            Vec2D a = polyline[i], ab = polyline[i + 1] - a;
+            float t = std::clamp(Vec2D::dot(pt - a, ab) / Vec2D::dot(ab, ab), 0.f, 1.f);
+            distance = std::min(distance, (a + ab * t - pt).length());
+        }
+    }
+    return distance;
+}
+
+// Appends 'quarterCount' quarters of a circle of radius 'r', counterclockwise from (r, 0), in the
+// same cubics rive uses for ellipses.
+static void add_circle_quarters(RawPath* path, float r, int quarterCount)
+{
+    constexpr static float kCircleConstant = 0.5522847498f;
+    float c = r * kCircleConstant;
+    const Vec2D quarters[4][3] = {{{r, c}, {c, r}, {0, r}},
+                                  {{-c, r}, {-r, c}, {-r, 0}},
+                                  {{-r, -c}, {-c, -r}, {0, -r}},
+                                  {{c, -r}, {r, -c}, {r, 0}}};
+    path->move({r, 0});
+    for (int i = 0; i < quarterCount; ++i)
+    {
+        path->cubic(quarters[i][0], quarters[i][1], quarters[i][2]);
+    }
+}
+
+TEST_CASE("thick-strokes-cover-small-circles", "[StrokeOutliner]")
+{
+    // The inner offset of a circle with radius 10 and a stroke radius of 100 folds over to the far
+    // side of the center. The whole disk of radius 110 still needs to be covered.
+    RawPath circle;
+    add_circle_quarters(&circle, 10, 4);
+    circle.close();
+    for (StrokeJoin join : {StrokeJoin::miter, StrokeJoin::round, StrokeJoin::bevel})
+    {
+        check_outline(circle, 100, join, StrokeCap::butt, 120, [](Vec2D pt, float tolerance) {
+            return pt.length() < 110 + tolerance;
+        });
+    }
+
+    // Thin strokes keep their holes.
+    RawPath bigCircle;
+    add_circle_quarters(&bigCircle, 100, 4);
+    bigCircle.close();
+    check_outline(bigCircle,
+                  10,
+                  StrokeJoin::round,
+                  StrokeCap::butt,
+                  120,
+                  [](Vec2D pt, float tolerance) {
+                      return fabsf(pt.length() - 100) < 10 + tolerance;
+                  });
+}
+
+TEST_CASE("thick-strokes-cover-tight-arcs", "[StrokeOutliner]")
+{
+    // An open 3/4 arc, much tighter than its stroke. The center of the arc has to be covered.
+    RawPath arc;
+    add_circle_quarters(&arc, 10, 3);
+    auto arcCenterline = flatten(arc);
+    check_outline(arc, 50, StrokeJoin::round, StrokeCap::round, 70, [&](Vec2D pt, float tolerance) {
+        return distance_to(arcCenterline, pt) < 50 + tolerance;
+    });
+
+    // A cubic with a tight hook, closed with a line. Where the curvature spikes, consecutive
+    // chords turn sharply.
+    RawPath hook;
+    hook.move({-25.3f, 7.8f});
+    hook.cubic({-6.9f, 49.5f}, {49.8f, -40.6f}, {9.6f, 18.2f});
+    hook.close();
+    auto hookCenterline = flatten(hook);
+    hookCenterline[0].push_back(hookCenterline[0][0]);
+    check_outline(hook,
+                  36,
+                  StrokeJoin::round,
+                  StrokeCap::round,
+                  100,
+                  [&](Vec2D pt, float tolerance) {
+                      return distance_to(hookCenterline, pt) < 36 + tolerance;
+                  });
+}
+} // namespace rive::pls